@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+template < typename AtomicPolicy >
+void ATOMIC_CONTENTION::runOpenMPVariantAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          ATOMIC_CONTENTION_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto atomic_contention_lam = [=](Index_type i) {
+                                     #pragma omp atomic
+                                     ATOMIC_CONTENTION_BODY;
+                                   };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          atomic_contention_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          ATOMIC_CONTENTION_RAJA_BODY(AtomicPolicy);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ATOMIC_CONTENTION : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void ATOMIC_CONTENTION::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  //
+  // Tunings are grouped by atomic policy; each group contains one tuning
+  // for every replication and spacing pair.
+  //
+  const size_t policy_idx = tune_idx / getNumReplicationTunings();
+
+  if (policy_idx == 0) {
+
+    runOpenMPVariantAtomic<RAJA::omp_atomic>(vid);
+
+  } else if (vid == RAJA_OpenMP && policy_idx == 1) {
+
+    runOpenMPVariantAtomic<RAJA::builtin_atomic>(vid);
+
+  } else {
+
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown OpenMP tuning id = "
+              << tune_idx << std::endl;
+
+  }
+
+#else
+  RAJAPERF_UNUSED_VAR(vid, tune_idx);
+#endif
+}
+
+void ATOMIC_CONTENTION::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addReplicationTuningNames(vid, "");
+
+  if (vid == RAJA_OpenMP) {
+    addReplicationTuningNames(vid, "builtin_atomic_");
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
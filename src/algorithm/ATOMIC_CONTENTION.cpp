@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+ATOMIC_CONTENTION::ATOMIC_CONTENTION(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_ATOMIC_CONTENTION, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  //
+  // Default replications span the PI_ATOMIC (one address) to DAXPY_ATOMIC
+  // (no conflicts) extremes; default spacings put targets in the same cache
+  // line or pad each target to its own (64 byte) cache line.
+  //
+  for (size_t replication : run_params.getAtomicReplications()) {
+    m_replications.emplace_back(static_cast<Index_type>(replication));
+  }
+  if (m_replications.empty()) {
+    m_replications = {1, 8, 64, 512, 4096};
+    if (getActualProblemSize() > m_replications.back()) {
+      m_replications.emplace_back(getActualProblemSize());
+    }
+  }
+  for (size_t spacing : run_params.getAtomicSpacings()) {
+    m_spacings.emplace_back(static_cast<Index_type>(spacing));
+  }
+  if (m_spacings.empty()) {
+    m_spacings = {1, static_cast<Index_type>(64 / sizeof(Real_type))};
+  }
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // each atomic update reads and writes its target
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+ATOMIC_CONTENTION::~ATOMIC_CONTENTION()
+{
+}
+
+void ATOMIC_CONTENTION::addReplicationTuningNames(VariantID vid,
+                                                  const std::string& prefix)
+{
+  for (Index_type replication : m_replications) {
+    for (Index_type spacing : m_spacings) {
+      addVariantTuningName(vid, prefix +
+                                "replicate_" + std::to_string(replication) +
+                                "_spacing_" + std::to_string(spacing));
+    }
+  }
+}
+
+void ATOMIC_CONTENTION::setUp(VariantID vid, size_t tune_idx)
+{
+  const size_t param_idx = tune_idx % getNumReplicationTunings();
+  m_replication = m_replications[param_idx / m_spacings.size()];
+  m_spacing = m_spacings[param_idx % m_spacings.size()];
+
+  allocAndInitDataConst(m_atomic, m_replication*m_spacing, 0.0, vid);
+  m_val = 1.0;
+}
+
+void ATOMIC_CONTENTION::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  //
+  // Sum only the target entries so the checksum does not depend on
+  // the replication and spacing of the tuning that was run.
+  //
+  Checksum_type sum = 0.0;
+  for (Index_type r = 0; r < m_replication; ++r) {
+    sum += m_atomic[r*m_spacing];
+  }
+  checksum[vid].at(tune_idx) += sum;
+}
+
+void ATOMIC_CONTENTION::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_atomic);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ATOMIC_CONTENTION kernel reference implementation:
+///
+/// const Index_type replication = ...;  -- num distinct target addresses
+/// const Index_type spacing = ...;      -- distance between target addresses
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   atomic[(i % replication) * spacing] += val;  -- performed atomically
+/// }
+///
+/// The number of distinct addresses and their spacing are tunings of the
+/// kernel and may be set with the --atomic_replication and --atomic_spacing
+/// command line options. A replication of 1 corresponds to the PI_ATOMIC
+/// pattern (all threads update one address) and a replication equal to the
+/// problem size corresponds to the DAXPY_ATOMIC pattern (no conflicts).
+/// A spacing of 1 places neighboring targets in the same cache line; a
+/// spacing of a cache line or more places each target in its own line.
+///
+
+#ifndef RAJAPerf_Algorithm_ATOMIC_CONTENTION_HPP
+#define RAJAPerf_Algorithm_ATOMIC_CONTENTION_HPP
+
+#define ATOMIC_CONTENTION_DATA_SETUP \
+  Real_ptr atomic = m_atomic; \
+  const Real_type val = m_val; \
+  const Index_type replication = m_replication; \
+  const Index_type spacing = m_spacing;
+
+#define ATOMIC_CONTENTION_INDEX(i) \
+  ( ((i) % replication) * spacing )
+
+#define ATOMIC_CONTENTION_BODY  \
+  atomic[ATOMIC_CONTENTION_INDEX(i)] += val ;
+
+#define ATOMIC_CONTENTION_RAJA_BODY(policy)  \
+  RAJA::atomicAdd<policy>(&atomic[ATOMIC_CONTENTION_INDEX(i)], val);
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class ATOMIC_CONTENTION : public KernelBase
+{
+public:
+
+  ATOMIC_CONTENTION(const RunParams& params);
+
+  ~ATOMIC_CONTENTION();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename AtomicPolicy >
+  void runOpenMPVariantAtomic(VariantID vid);
+
+private:
+  size_t getNumReplicationTunings() const
+  { return m_replications.size() * m_spacings.size(); }
+  void addReplicationTuningNames(VariantID vid, const std::string& prefix);
+
+  std::vector<Index_type> m_replications;
+  std::vector<Index_type> m_spacings;
+
+  Real_ptr m_atomic;
+  Real_type m_val;
+  Index_type m_replication;
+  Index_type m_spacing;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,230 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RunParams.hpp"
+#include "common/DataUtils.hpp"
+#include "AlgorithmData.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+//
+// Get index pattern parameters to run.
+//
+std::vector<IndexPatternParams> getIndexPatternParams(const RunParams& params)
+{
+  std::vector<Index_type> windows;
+  for (size_t window : params.getIndexWindows()) {
+    windows.emplace_back(static_cast<Index_type>(window));
+  }
+  if (windows.empty()) {
+    windows = {static_cast<Index_type>(64 / sizeof(Real_type)),
+               static_cast<Index_type>(4096 / sizeof(Real_type))};
+  }
+
+  std::vector<IndexPatternParams> pattern_params;
+  pattern_params.push_back({IndexPattern::sequential, 1});
+  for (Index_type window : windows) {
+    pattern_params.push_back({IndexPattern::strided, window});
+  }
+  for (Index_type window : windows) {
+    pattern_params.push_back({IndexPattern::blocked_random, window});
+  }
+  pattern_params.push_back({IndexPattern::random, 1});
+
+  return pattern_params;
+}
+
+//
+// Get tuning name for index pattern parameters.
+//
+std::string getIndexPatternName(const IndexPatternParams& pattern_params)
+{
+  switch (pattern_params.pattern) {
+    case IndexPattern::sequential :
+      return "sequential";
+    case IndexPattern::strided :
+      return "strided_" + std::to_string(pattern_params.window);
+    case IndexPattern::blocked_random :
+      return "blocked_random_" + std::to_string(pattern_params.window);
+    case IndexPattern::random :
+      return "random";
+  }
+  return "unknown";
+}
+
+//
+// Set index array to a permutation in the given pattern.
+//
+void setIndexPattern(Int_ptr idx, Index_type len,
+                     const IndexPatternParams& pattern_params)
+{
+  const Index_type window = std::max(pattern_params.window, Index_type(1));
+
+  // fixed seed so every variant and tuning sees the same permutations
+  std::mt19937 gen(4793);
+
+  auto shuffle = [&](Index_type begin, Index_type end) {
+    for (Index_type i = end - 1; i > begin; --i) {
+      Index_type j = begin + static_cast<Index_type>(gen() % (i - begin + 1));
+      std::swap(idx[i], idx[j]);
+    }
+  };
+
+  switch (pattern_params.pattern) {
+
+    case IndexPattern::sequential : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = i;
+      }
+      break;
+    }
+
+    case IndexPattern::strided : {
+      // visit every window-th element, then the ones offset by 1, etc.
+      Index_type i = 0;
+      for (Index_type offset = 0; offset < window; ++offset) {
+        for (Index_type j = offset; j < len; j += window) {
+          idx[i++] = j;
+        }
+      }
+      break;
+    }
+
+    case IndexPattern::blocked_random : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = i;
+      }
+      for (Index_type begin = 0; begin < len; begin += window) {
+        shuffle(begin, std::min(begin + window, len));
+      }
+      break;
+    }
+
+    case IndexPattern::random : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = i;
+      }
+      shuffle(0, len);
+      break;
+    }
+
+  }
+}
+
+//
+// Get index pattern parameters and index mode of a tuning.
+//
+const IndexPatternParams& getTuningIndexPattern(
+    const std::vector<IndexPatternParams>& pattern_params, size_t tune_idx)
+{
+  return pattern_params[tune_idx / num_index_modes];
+}
+
+IndexMode getTuningIndexMode(size_t tune_idx)
+{
+  return static_cast<IndexMode>(tune_idx % num_index_modes);
+}
+
+//
+// Get tuning name suffix for an index mode.
+//
+static std::string getIndexModeSuffix(IndexMode mode)
+{
+  switch (mode) {
+    case IndexMode::direct : return "";
+    case IndexMode::prefetch : return "_prefetch";
+    case IndexMode::sorted : return "_sorted";
+  }
+  return "";
+}
+
+//
+// Add index pattern tunings to kernel.
+//
+void addIndexPatternTuningNames(KernelBase* kernel, VariantID vid,
+    const std::vector<IndexPatternParams>& pattern_params)
+{
+  for (size_t t = 0; t < pattern_params.size() * num_index_modes; ++t) {
+    kernel->addVariantTuningName(vid,
+        getIndexPatternName(getTuningIndexPattern(pattern_params, t)) +
+        getIndexModeSuffix(getTuningIndexMode(t)));
+  }
+}
+
+//
+// Set bytes per rep of index pattern tunings.
+//
+void setIndexPatternTuningBytesPerRep(KernelBase* kernel,
+    const std::vector<IndexPatternParams>& pattern_params,
+    Index_type len, Index_type data_bytes_per_index)
+{
+  for (size_t t = 0; t < pattern_params.size() * num_index_modes; ++t) {
+    const IndexMode mode = getTuningIndexMode(t);
+    Index_type index_bytes = 0;
+    switch (mode) {
+      case IndexMode::direct :
+        index_bytes = 1*sizeof(Int_type) * len;
+        break;
+      case IndexMode::prefetch :
+        index_bytes = 1*sizeof(Int_type) * (len + index_prefetch_distance);
+        break;
+      case IndexMode::sorted :
+        index_bytes = 2*sizeof(Int_type) * len;
+        break;
+    }
+    kernel->setTuningBytesPerRep(
+        getIndexPatternName(getTuningIndexPattern(pattern_params, t)) +
+        getIndexModeSuffix(mode),
+        data_bytes_per_index * len + index_bytes);
+  }
+}
+
+//
+// Allocate and set index arrays for an index pattern.
+//
+void allocAndInitIndexPattern(Int_ptr& idx, Int_ptr& sorted_idx,
+                              Int_ptr& sorted_pos, Index_type len,
+                              const IndexPatternParams& pattern_params)
+{
+  allocData(idx, len + index_prefetch_distance);
+  allocData(sorted_idx, len);
+  allocData(sorted_pos, len);
+
+  setIndexPattern(idx, len, pattern_params);
+  for (Index_type i = len; i < len + index_prefetch_distance; ++i) {
+    idx[i] = 0;
+  }
+  setSortedIndexPattern(sorted_idx, sorted_pos, idx, len);
+}
+
+//
+// Set index value and position arrays sorted by index value.
+//
+void setSortedIndexPattern(Int_ptr sorted_idx, Int_ptr sorted_pos,
+                           const Int_ptr idx, Index_type len)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    sorted_pos[i] = i;
+  }
+  std::stable_sort(sorted_pos, sorted_pos + len,
+                   [=](Int_type a, Int_type b) { return idx[a] < idx[b]; });
+  for (Index_type i = 0; i < len; ++i) {
+    sorted_idx[i] = idx[sorted_pos[i]];
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
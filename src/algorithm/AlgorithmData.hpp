@@ -0,0 +1,152 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJAPerf_AlgorithmData_HPP
+#define RAJAPerf_AlgorithmData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+//
+// Software prefetch hints used by indirect access kernel tunings.
+//
+#if defined(__GNUC__)
+#define RAJAPERF_PREFETCH_READ(addr)  __builtin_prefetch((addr), 0)
+#define RAJAPERF_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1)
+#else
+#define RAJAPERF_PREFETCH_READ(addr)
+#define RAJAPERF_PREFETCH_WRITE(addr)
+#endif
+
+//
+// Number of iterations ahead of the current one that prefetch tunings
+// request data for; index arrays are padded by this many entries.
+//
+const Index_type index_prefetch_distance = 16;
+
+//
+// Orderings of the permutation index arrays used by indirect access kernels.
+//
+enum struct IndexPattern
+{
+  sequential,     // idx[i] = i
+  strided,        // consecutive entries are window elements apart
+  blocked_random, // random permutation within each block of window elements
+  random          // random permutation of the whole range
+};
+
+//
+// Index pattern and locality window pair describing one kernel tuning.
+//
+struct IndexPatternParams
+{
+  IndexPattern pattern;
+  Index_type window;
+};
+
+//
+// Orders in which indirect access kernel tunings visit the index array.
+// Tunings are grouped by index pattern; each group has one tuning per mode,
+// in this order.
+//
+enum struct IndexMode
+{
+  direct,   // iteration order
+  prefetch, // iteration order, prefetching index_prefetch_distance ahead
+  sorted    // order of increasing index
+};
+
+const size_t num_index_modes = 3;
+
+//
+// Index pattern parameters to run, using the --index_window windows when
+// given and cache line and page sized windows otherwise.
+//
+std::vector<IndexPatternParams> getIndexPatternParams(const RunParams& params);
+
+//
+// Tuning name for index pattern parameters, e.g. "blocked_random_512".
+//
+std::string getIndexPatternName(const IndexPatternParams& pattern_params);
+
+//
+// Index pattern parameters and index mode of the tuning with index tune_idx.
+//
+const IndexPatternParams& getTuningIndexPattern(
+    const std::vector<IndexPatternParams>& pattern_params, size_t tune_idx);
+IndexMode getTuningIndexMode(size_t tune_idx);
+
+//
+// Add a tuning for each index pattern and mode of an indirect access kernel,
+// e.g. "random", "random_prefetch", and "random_sorted".
+//
+void addIndexPatternTuningNames(KernelBase* kernel, VariantID vid,
+    const std::vector<IndexPatternParams>& pattern_params);
+
+//
+// Set the bytes per rep of each tuning added by addIndexPatternTuningNames
+// from the bytes of data moved per index; the prefetch tunings read the
+// padded index array and the sorted tunings read two index arrays.
+//
+void setIndexPatternTuningBytesPerRep(KernelBase* kernel,
+    const std::vector<IndexPatternParams>& pattern_params,
+    Index_type len, Index_type data_bytes_per_index);
+
+//
+// Run the tuning with index tune_idx of an indirect access kernel by calling
+// the run method for its index mode.
+//
+template < typename Kernel >
+void runIndexModeTuning(Kernel* kernel, VariantID vid, size_t tune_idx,
+                        void (Kernel::*run_direct)(VariantID),
+                        void (Kernel::*run_prefetch)(VariantID),
+                        void (Kernel::*run_sorted)(VariantID))
+{
+  switch ( getTuningIndexMode(tune_idx) ) {
+    case IndexMode::direct : (kernel->*run_direct)(vid); break;
+    case IndexMode::prefetch : (kernel->*run_prefetch)(vid); break;
+    case IndexMode::sorted : (kernel->*run_sorted)(vid); break;
+  }
+}
+
+//
+// Allocate and fill the index arrays of an indirect access kernel for the
+// given index pattern. idx is padded with index_prefetch_distance zero
+// entries so the prefetch tunings may look past the end.
+//
+void allocAndInitIndexPattern(Int_ptr& idx, Int_ptr& sorted_idx,
+                              Int_ptr& sorted_pos, Index_type len,
+                              const IndexPatternParams& pattern_params);
+
+//
+// Fill idx[0, len) with a permutation of [0, len) in the given pattern.
+//
+void setIndexPattern(Int_ptr idx, Index_type len,
+                     const IndexPatternParams& pattern_params);
+
+//
+// Fill sorted_idx and sorted_pos with the entries of idx and their positions
+// ordered by increasing index value.
+//
+void setSortedIndexPattern(Int_ptr sorted_idx, Int_ptr sorted_pos,
+                           const Int_ptr idx, Index_type len);
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+GATHER::GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_pattern_params = getIndexPatternParams(run_params);
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // default tunings read idx and y and write x
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  getActualProblemSize() );
+  setIndexPatternTuningBytesPerRep(this, m_pattern_params,
+                                   getActualProblemSize(),
+                                   1*sizeof(Real_type) + 1*sizeof(Real_type));
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+GATHER::~GATHER()
+{
+}
+
+void GATHER::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  allocAndInitDataConst(m_x, len, 0.0, vid);
+  allocAndInitData(m_y, len, vid);
+
+  allocAndInitIndexPattern(m_idx, m_sorted_idx, m_sorted_pos, len,
+                           getTuningIndexPattern(m_pattern_params, tune_idx));
+}
+
+void GATHER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  //
+  // Checksum x in index order so the result does not depend on the
+  // index pattern of the tuning that was run.
+  //
+  const Index_type len = getActualProblemSize();
+  std::vector<Real_type> x_ordered(len);
+  for (Index_type i = 0; i < len; ++i) {
+    x_ordered[m_idx[i]] = m_x[i];
+  }
+  checksum[vid][tune_idx] += calcChecksum(x_ordered.data(), len);
+}
+
+void GATHER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_idx);
+  deallocData(m_sorted_idx);
+  deallocData(m_sorted_pos);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
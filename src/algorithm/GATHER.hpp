@@ -0,0 +1,115 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GATHER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   x[i] = y[idx[i]];
+/// }
+///
+/// The index array is a permutation whose ordering (sequential, strided,
+/// blocked random, or random) is a tuning of the kernel; the locality window
+/// used by the strided and blocked random orderings may be set with the
+/// --index_window command line option. Each ordering has a prefetch tuning
+/// that requests y[idx[i + prefetch_distance]] ahead of use and a sorted
+/// tuning that visits the entries in order of increasing index, trading
+/// indirect reads of y for indirect writes of x.
+///
+
+#ifndef RAJAPerf_Algorithm_GATHER_HPP
+#define RAJAPerf_Algorithm_GATHER_HPP
+
+#define GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define GATHER_PREFETCH_DATA_SETUP \
+  GATHER_DATA_SETUP \
+  const Index_type prefetch_distance = index_prefetch_distance;
+
+#define GATHER_SORTED_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr sorted_idx = m_sorted_idx; \
+  Int_ptr sorted_pos = m_sorted_pos;
+
+#define GATHER_BODY  \
+  x[i] = y[idx[i]];
+
+#define GATHER_PREFETCH_BODY  \
+  RAJAPERF_PREFETCH_READ(&y[idx[i + prefetch_distance]]); \
+  x[i] = y[idx[i]];
+
+#define GATHER_SORTED_BODY  \
+  x[sorted_pos[i]] = y[sorted_idx[i]];
+
+
+#include "common/KernelBase.hpp"
+#include "AlgorithmData.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class GATHER : public KernelBase
+{
+public:
+
+  GATHER(const RunParams& params);
+
+  ~GATHER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GATHER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid);
+  void runSeqVariantSorted(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid);
+  void runOpenMPVariantSorted(VariantID vid);
+
+private:
+  std::vector<IndexPatternParams> m_pattern_params;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+  Int_ptr m_sorted_idx;
+  Int_ptr m_sorted_pos;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
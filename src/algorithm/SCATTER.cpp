@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCATTER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+SCATTER::SCATTER(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_SCATTER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_pattern_params = getIndexPatternParams(run_params);
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // default tunings read idx and x and write y
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  getActualProblemSize() );
+  setIndexPatternTuningBytesPerRep(this, m_pattern_params,
+                                   getActualProblemSize(),
+                                   1*sizeof(Real_type) + 1*sizeof(Real_type));
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SCATTER::~SCATTER()
+{
+}
+
+void SCATTER::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  allocAndInitData(m_x, len, vid);
+  allocAndInitDataConst(m_y, len, 0.0, vid);
+
+  allocAndInitIndexPattern(m_idx, m_sorted_idx, m_sorted_pos, len,
+                           getTuningIndexPattern(m_pattern_params, tune_idx));
+}
+
+void SCATTER::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  //
+  // Checksum y in iteration order so the result does not depend on the
+  // index pattern of the tuning that was run.
+  //
+  const Index_type len = getActualProblemSize();
+  std::vector<Real_type> y_ordered(len);
+  for (Index_type i = 0; i < len; ++i) {
+    y_ordered[i] = m_y[m_idx[i]];
+  }
+  checksum[vid][tune_idx] += calcChecksum(y_ordered.data(), len);
+}
+
+void SCATTER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_idx);
+  deallocData(m_sorted_idx);
+  deallocData(m_sorted_pos);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SCATTER kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   y[idx[i]] = x[i];
+/// }
+///
+/// The index array is a permutation whose ordering (sequential, strided,
+/// blocked random, or random) is a tuning of the kernel; the locality window
+/// used by the strided and blocked random orderings may be set with the
+/// --index_window command line option. Since the index array is a permutation
+/// no two iterations write the same entry of y. Each ordering has a prefetch
+/// tuning that requests y[idx[i + prefetch_distance]] for writing ahead of use
+/// and a sorted tuning that visits the entries in order of increasing index,
+/// trading indirect writes of y for indirect reads of x.
+///
+
+#ifndef RAJAPerf_Algorithm_SCATTER_HPP
+#define RAJAPerf_Algorithm_SCATTER_HPP
+
+#define SCATTER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define SCATTER_PREFETCH_DATA_SETUP \
+  SCATTER_DATA_SETUP \
+  const Index_type prefetch_distance = index_prefetch_distance;
+
+#define SCATTER_SORTED_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr sorted_idx = m_sorted_idx; \
+  Int_ptr sorted_pos = m_sorted_pos;
+
+#define SCATTER_BODY  \
+  y[idx[i]] = x[i];
+
+#define SCATTER_PREFETCH_BODY  \
+  RAJAPERF_PREFETCH_WRITE(&y[idx[i + prefetch_distance]]); \
+  y[idx[i]] = x[i];
+
+#define SCATTER_SORTED_BODY  \
+  y[sorted_idx[i]] = x[sorted_pos[i]];
+
+
+#include "common/KernelBase.hpp"
+#include "AlgorithmData.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class SCATTER : public KernelBase
+{
+public:
+
+  SCATTER(const RunParams& params);
+
+  ~SCATTER();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SCATTER : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantPrefetch(VariantID vid);
+  void runSeqVariantSorted(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantPrefetch(VariantID vid);
+  void runOpenMPVariantSorted(VariantID vid);
+
+private:
+  std::vector<IndexPatternParams> m_pattern_params;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+  Int_ptr m_sorted_idx;
+  Int_ptr m_sorted_pos;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -7,15 +7,111 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 #include "common/RAJAPerfSuite.hpp"
+#include "common/RunParams.hpp"
 #include "AppsData.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
 
 namespace rajaperf
 {
 namespace apps
 {
 
+ADomain::ADomain( Index_type rzmax, Index_type ndims,
+                  const RunParams& params )
+   : ndims(ndims), NPNL(2), NPNR(1)
+{
+   if ( params.getDomainGhosts() > 0 ) {
+      NPNL = params.getDomainGhosts();
+      NPNR = params.getDomainGhosts();
+   }
+
+   const std::vector<double>& aspect = params.getDomainAspect();
+   double scale = ( ndims == 2 ) ? std::sqrt(aspect[0] * aspect[1])
+                                 : std::cbrt(aspect[0] * aspect[1] * aspect[2]);
+
+   auto extent = [=](double a) {
+      return std::max(Index_type(NPNL - NPNR + 1),
+                      static_cast<Index_type>(std::lround(rzmax * a / scale)));
+   };
+
+   setup(extent(aspect[0]), extent(aspect[1]), extent(aspect[2]),
+         params.getDomainPad());
+}
+
+//
+// Set index ranges and strides of the domain and its list of real zones.
+// Each row (and plane in 3d) stride is padded by pad entries, which are
+// never real zones.
+//
+void ADomain::setup(Index_type irzmax, Index_type jrzmax, Index_type krzmax,
+                    Index_type pad)
+{
+   imin = NPNL;
+   jmin = NPNL;
+   imax = irzmax + NPNR;
+   jmax = jrzmax + NPNR;
+   jp = imax - imin + 1 + NPNL + NPNR + pad;
+
+   if ( ndims == 2 ) {
+      kmin = 0;
+      kmax = 0;
+      kp = 0;
+      nnalls = jp * (jmax - jmin + 1 + NPNL + NPNR) ;
+   } else if ( ndims == 3 ) {
+      kmin = NPNL;
+      kmax = krzmax + NPNR;
+      kp = jp * (jmax - jmin + 1 + NPNL + NPNR) + pad;
+      nnalls = kp * (kmax - kmin + 1 + NPNL + NPNR) ;
+   }
+
+   fpn = 0;
+   lpn = nnalls - 1;
+   frn = imin + jmin*jp + kmin*kp;
+   lrn = imax + jmax*jp + kmax*kp;
+
+   fpz = frn - jp - kp - 1;
+   lpz = lrn;
+
+   real_zones = new Index_type[nnalls];
+   for (Index_type i = 0; i < nnalls; ++i) real_zones[i] = -1;
+
+   n_real_zones = 0;
+
+   if ( ndims == 2 ) {
+
+      for (Index_type j = jmin; j < jmax; j++) {
+         for (Index_type i = imin; i < imax; i++) {
+            Index_type ip = i + j*jp ;
+
+            Index_type id = n_real_zones;
+            real_zones[id] = ip;
+            n_real_zones++;
+         }
+      }
+
+   } else if ( ndims == 3 ) {
+
+      for (Index_type k = kmin; k < kmax; k++) { 
+         for (Index_type j = jmin; j < jmax; j++) {
+            for (Index_type i = imin; i < imax; i++) {
+               Index_type ip = i + j*jp + kp*k ;
+
+               Index_type id = n_real_zones;
+               real_zones[id] = ip;
+               n_real_zones++;
+            }
+         }
+      } 
+
+   }
+}
+
 //
 // Set mesh positions for 2d mesh.
 //
@@ -110,5 +206,235 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
   }
 }
 
+
+//
+// Partition the real zones of a 3d domain into 8 colors by the parity of
+// their i, j, k indices, so zones of the same color share no nodes.
+// The zones of color c are colored_zones[color_offsets[c]] through
+// colored_zones[color_offsets[c+1]-1]; colored_zones must hold
+// domain.n_real_zones entries and color_offsets 9 entries.
+//
+void setColoredZones_3d(Index_ptr colored_zones, Index_ptr color_offsets,
+                        const ADomain& domain)
+{
+  if (domain.ndims != 3) {
+    getCout() << "\n******* ERROR!!! domain is not 3d *******" << std::endl;
+    return;
+  }
+
+  Index_type imin = domain.imin;
+  Index_type imax = domain.imax;
+  Index_type jmin = domain.jmin;
+  Index_type jmax = domain.jmax;
+  Index_type kmin = domain.kmin;
+  Index_type kmax = domain.kmax;
+
+  Index_type jp = domain.jp;
+  Index_type kp = domain.kp;
+
+  Index_type id = 0;
+  for (Index_type c = 0; c < 8; ++c) {
+     color_offsets[c] = id;
+     for (Index_type k = kmin + (c/4)%2; k < kmax; k += 2) {
+        for (Index_type j = jmin + (c/2)%2; j < jmax; j += 2) {
+           for (Index_type i = imin + c%2; i < imax; i += 2) {
+              colored_zones[id] = i + j*jp + kp*k ;
+              id++;
+           }
+        }
+     }
+  }
+  color_offsets[8] = id;
+}
+
+//
+// Set the index of the first real zone of each row (fixed j, and k in 3d)
+// of real zones of a domain, in lexicographic order. Each row holds
+// imax - imin contiguous zones; row_begins must hold (jmax - jmin) entries
+// in 2d and (jmax - jmin)*(kmax - kmin) entries in 3d.
+//
+void setRealZoneRows(Index_ptr row_begins, const ADomain& domain)
+{
+  Index_type kbegin = ( domain.ndims == 2 ) ? 0 : domain.kmin;
+  Index_type kend   = ( domain.ndims == 2 ) ? 1 : domain.kmax;
+
+  Index_type id = 0;
+  for (Index_type k = kbegin; k < kend; ++k) {
+     for (Index_type j = domain.jmin; j < domain.jmax; ++j) {
+        row_begins[id++] = domain.imin + j*domain.jp + k*domain.kp;
+     }
+  }
+}
+
+std::string getZoneOrderName(ZoneOrder order)
+{
+  switch ( order ) {
+    case ZoneOrder::lexicographic : return "lexicographic";
+    case ZoneOrder::morton : return "morton";
+    case ZoneOrder::hilbert : return "hilbert";
+    case ZoneOrder::random : return "random";
+  }
+  return "unknown";
+}
+
+ZoneOrder getZoneOrder(std::string const& tuning_name)
+{
+  for (ZoneOrder order : {ZoneOrder::morton,
+                          ZoneOrder::hilbert,
+                          ZoneOrder::random}) {
+    if ( tuning_name == getZoneOrderName(order) ) {
+      return order;
+    }
+  }
+  return ZoneOrder::lexicographic;
+}
+
+//
+// Interleave the low nbits bits of the ndims coordinates in X into a
+// single key, most significant bit first and X[0] first at each level.
+//
+static Index_type interleaveBits(const Index_type* X, Index_type ndims,
+                                 Index_type nbits)
+{
+  Index_type key = 0;
+  for (Index_type b = nbits - 1; b >= 0; --b) {
+    for (Index_type d = 0; d < ndims; ++d) {
+      key = (key << 1) | ((X[d] >> b) & 1);
+    }
+  }
+  return key;
+}
+
+//
+// Convert coordinates in X to the "transposed" Hilbert index in place,
+// following J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc.
+// 707 (2004); interleaving the result gives the Hilbert key.
+//
+static void axesToHilbertTranspose(Index_type* X, Index_type ndims,
+                                   Index_type nbits)
+{
+  const Index_type M = Index_type(1) << (nbits - 1);
+
+  // inverse undo
+  for (Index_type Q = M; Q > 1; Q >>= 1) {
+    const Index_type P = Q - 1;
+    for (Index_type d = 0; d < ndims; ++d) {
+      if ( X[d] & Q ) {
+        X[0] ^= P;
+      } else {
+        Index_type t = (X[0] ^ X[d]) & P;
+        X[0] ^= t;
+        X[d] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (Index_type d = 1; d < ndims; ++d) {
+    X[d] ^= X[d-1];
+  }
+  Index_type t = 0;
+  for (Index_type Q = M; Q > 1; Q >>= 1) {
+    if ( X[ndims-1] & Q ) { t ^= Q - 1; }
+  }
+  for (Index_type d = 0; d < ndims; ++d) {
+    X[d] ^= t;
+  }
+}
+
+//
+// Sort zone indices by the chosen order. Zone coordinates are recovered
+// from the zone index using the domain strides.
+//
+void setZoneOrder(Index_ptr zones, Index_type nzones, ZoneOrder order,
+                  const ADomain& domain)
+{
+  if ( order == ZoneOrder::lexicographic ) {
+    std::sort(zones, zones + nzones);
+    return;
+  }
+
+  if ( order == ZoneOrder::random ) {
+    std::sort(zones, zones + nzones);
+    std::mt19937_64 gen(4793);
+    std::shuffle(zones, zones + nzones, gen);
+    return;
+  }
+
+  const Index_type ndims = domain.ndims;
+  const Index_type jp = domain.jp;
+  const Index_type kp = domain.kp;
+
+  auto get_coords = [=](Index_type iz, Index_type* X) {
+    Index_type rem = ( ndims == 3 ) ? iz % kp : iz;
+    X[0] = rem % jp;
+    X[1] = rem / jp;
+    X[2] = ( ndims == 3 ) ? iz / kp : 0;
+  };
+
+  Index_type max_coord = 1;
+  for (Index_type ii = 0; ii < nzones; ++ii) {
+    Index_type X[3];
+    get_coords(zones[ii], X);
+    for (Index_type d = 0; d < ndims; ++d) {
+      max_coord = std::max(max_coord, X[d]);
+    }
+  }
+  Index_type nbits = 1;
+  while ( (Index_type(1) << nbits) <= max_coord ) { ++nbits; }
+
+  std::vector<std::pair<Index_type, Index_type>> keyed(nzones);
+  for (Index_type ii = 0; ii < nzones; ++ii) {
+    Index_type X[3];
+    get_coords(zones[ii], X);
+    if ( order == ZoneOrder::hilbert ) {
+      axesToHilbertTranspose(X, ndims, nbits);
+    }
+    keyed[ii] = std::make_pair(interleaveBits(X, ndims, nbits), zones[ii]);
+  }
+
+  std::sort(keyed.begin(), keyed.end());
+
+  for (Index_type ii = 0; ii < nzones; ++ii) {
+    zones[ii] = keyed[ii].second;
+  }
+}
+
+//
+// Convert element-major data to element-interleaved batches.
+//
+void interleaveElements(Real_ptr inter, const Real_ptr data,
+                        Index_type elem_len, Index_type nelem,
+                        Index_type nbatch)
+{
+  Index_type nbatches = (nelem + nbatch - 1) / nbatch;
+
+  for (Index_type b = 0; b < nbatches; ++b) {
+    for (Index_type i = 0; i < elem_len; ++i) {
+      for (Index_type l = 0; l < nbatch; ++l) {
+        Index_type e = b*nbatch + l;
+        inter[(b*elem_len + i)*nbatch + l] =
+          (e < nelem) ? data[e*elem_len + i] : 0.0;
+      }
+    }
+  }
+}
+
+//
+// Convert element-interleaved batches back to element-major data.
+//
+void deinterleaveElements(Real_ptr data, const Real_ptr inter,
+                          Index_type elem_len, Index_type nelem,
+                          Index_type nbatch)
+{
+  for (Index_type e = 0; e < nelem; ++e) {
+    Index_type b = e / nbatch;
+    Index_type l = e % nbatch;
+    for (Index_type i = 0; i < elem_len; ++i) {
+      data[e*elem_len + i] = inter[(b*elem_len + i)*nbatch + l];
+    }
+  }
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -11,8 +11,12 @@
 
 #include "common/RPTypes.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
+class RunParams;
+
 namespace apps
 {
 
@@ -50,67 +54,16 @@ public:
    ADomain( Index_type rzmax, Index_type ndims ) 
       : ndims(ndims), NPNL(2), NPNR(1)
    {
-      imin = NPNL;
-      jmin = NPNL;
-      imax = rzmax + NPNR;
-      jmax = rzmax + NPNR;
-      jp = imax - imin + 1 + NPNL + NPNR;
-
-      if ( ndims == 2 ) {
-         kmin = 0;
-         kmax = 0;
-         kp = 0;
-         nnalls = jp * (jmax - jmin + 1 + NPNL + NPNR) ;
-      } else if ( ndims == 3 ) {
-         kmin = NPNL;
-         kmax = rzmax + NPNR;
-         kp = jp * (jmax - jmin + 1 + NPNL + NPNR);
-         nnalls = kp * (kmax - kmin + 1 + NPNL + NPNR) ;
-      }
-
-      fpn = 0;
-      lpn = nnalls - 1;
-      frn = fpn + NPNL * (kp + jp) + NPNL;
-      lrn = lpn - NPNR * (kp + jp) - NPNR;
-
-      fpz = frn - jp - kp - 1;
-      lpz = lrn;
-
-      real_zones = new Index_type[nnalls];
-      for (Index_type i = 0; i < nnalls; ++i) real_zones[i] = -1;
-
-      n_real_zones = 0;
-
-      if ( ndims == 2 ) {
-
-         for (Index_type j = jmin; j < jmax; j++) {
-            for (Index_type i = imin; i < imax; i++) {
-               Index_type ip = i + j*jp ;
-
-               Index_type id = n_real_zones;
-               real_zones[id] = ip;
-               n_real_zones++;
-            }
-         }
-
-      } else if ( ndims == 3 ) {
-
-         for (Index_type k = kmin; k < kmax; k++) { 
-            for (Index_type j = jmin; j < jmax; j++) {
-               for (Index_type i = imin; i < imax; i++) {
-                  Index_type ip = i + j*jp + kp*k ;
-
-                  Index_type id = n_real_zones;
-                  real_zones[id] = ip;
-                  n_real_zones++;
-               }
-            }
-         } 
-
-      }
-
+      setup(rzmax, rzmax, rzmax, 0);
    }
 
+   //
+   // Domain shaped by the --domain_aspect, --domain_ghosts, and
+   // --domain_pad run options; extents are scaled so the number of zones
+   // is about the same as for the cubic (square) rzmax domain.
+   //
+   ADomain( Index_type rzmax, Index_type ndims, const RunParams& params );
+
    ~ADomain() 
    {
       if (real_zones) delete [] real_zones; 
@@ -141,6 +94,10 @@ public:
 
    Index_type* real_zones;
    Index_type  n_real_zones;
+
+private:
+   void setup(Index_type irzmax, Index_type jrzmax, Index_type krzmax,
+              Index_type pad);
 };
 
 //
@@ -155,6 +112,60 @@ void setMeshPositions_3d(Real_ptr x, Real_type dx,
                          Real_ptr z, Real_type dz,
                          const ADomain& domain);
 
+//
+// Routine for partitioning the real zones of a 3d domain into 8 colors.
+//
+void setColoredZones_3d(Index_ptr colored_zones, Index_ptr color_offsets,
+                        const ADomain& domain);
+
+//
+// Routine for setting the first zone index of each row of real zones of
+// a domain; each row holds imax - imin contiguous zones.
+//
+void setRealZoneRows(Index_ptr row_begins, const ADomain& domain);
+
+//
+// Orders in which the zones of a domain may be traversed.
+//
+enum struct ZoneOrder {
+  lexicographic = 0,  // i fastest, then j, then k
+  morton,             // Z-order space-filling curve
+  hilbert,            // Hilbert space-filling curve
+  random              // fixed-seed random permutation (worst case locality)
+};
+
+std::string getZoneOrderName(ZoneOrder order);
+
+//
+// Zone order for a kernel tuning; tunings named by getZoneOrderName
+// select that order, all other tunings use lexicographic order.
+//
+ZoneOrder getZoneOrder(std::string const& tuning_name);
+
+//
+// Routine for sorting a list of zone indices of a domain into the given
+// order; zones may be any (real or ghost) zone indices of the domain.
+// The mesh data layout is unchanged, only the traversal order of the
+// list is modified.
+//
+void setZoneOrder(Index_ptr zones, Index_type nzones, ZoneOrder order,
+                  const ADomain& domain);
+
+//
+// Routines for converting per-element data between element-major order
+// and an element-interleaved order, where batches of nbatch elements store
+// each of their elem_len values for all elements of the batch contiguously.
+// The interleaved array holds ceil(nelem/nbatch)*nbatch elements and lanes
+// past the last element are set to zero.
+//
+void interleaveElements(Real_ptr inter, const Real_ptr data,
+                        Index_type elem_len, Index_type nelem,
+                        Index_type nbatch);
+
+void deinterleaveElements(Real_ptr data, const Real_ptr inter,
+                          Index_type elem_len, Index_type nelem,
+                          Index_type nbatch);
+
 } // end namespace apps
 } // end namespace rajaperf
 
@@ -190,6 +190,12 @@
 ///   }
 /// } // element loop
 ///
+/// The CPU variants are templated on the number of dofs (D1D) and
+/// quadrature points (Q1D) per dimension. The --pa_order option selects
+/// polynomial order p, with D1D = p+1 and Q1D = p+2, for orders 1 to 6;
+/// by default CPA_D1D and CPA_Q1D are used. Iterations per rep count the
+/// dofs, so its/rep divided by the time per rep gives dofs per second.
+///
 
 #ifndef RAJAPerf_Apps_CONVECTION3DPA_HPP
 #define RAJAPerf_Apps_CONVECTION3DPA_HPP
@@ -212,15 +218,15 @@ Index_type NE = m_NE;
 #define CPA_D1D 3
 #define CPA_Q1D 4
 #define CPA_VDIM 3
-#define cpa_B(x, y) Basis[x + CPA_Q1D * y]
-#define cpa_Bt(x, y) tBasis[x + CPA_D1D * y]
-#define cpa_G(x, y) dBasis[x + CPA_Q1D * y]
+#define cpa_B(x, y) Basis[x + max_Q1D * y]
+#define cpa_Bt(x, y) tBasis[x + max_D1D * y]
+#define cpa_G(x, y) dBasis[x + max_Q1D * y]
 #define cpaX_(dx, dy, dz, e)                                                     \
-  X[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  X[dx + max_D1D * dy + max_D1D * max_D1D * dz + max_D1D * max_D1D * max_D1D * e]
 #define cpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + CPA_D1D * dy + CPA_D1D * CPA_D1D * dz + CPA_D1D * CPA_D1D * CPA_D1D * e]
+  Y[dx + max_D1D * dy + max_D1D * max_D1D * dz + max_D1D * max_D1D * max_D1D * e]
 #define cpa_op(qx, qy, qz, d, e)                                       \
-  D[qx + CPA_Q1D * qy + CPA_Q1D * CPA_Q1D * qz + CPA_Q1D * CPA_Q1D * CPA_Q1D * d  +  CPA_VDIM * CPA_Q1D * CPA_Q1D * CPA_Q1D * e]
+  D[qx + max_Q1D * qy + max_Q1D * max_Q1D * qz + max_Q1D * max_Q1D * max_Q1D * d  +  CPA_VDIM * max_Q1D * max_Q1D * max_Q1D * e]
 
 #define CONVECTION3DPA_0_GPU \
   constexpr int max_D1D = CPA_D1D; \
@@ -247,8 +253,8 @@ Index_type NE = m_NE;
 
 
 #define CONVECTION3DPA_0_CPU \
-  constexpr int max_D1D = CPA_D1D; \
-  constexpr int max_Q1D = CPA_Q1D; \
+  constexpr int max_D1D = D1D; \
+  constexpr int max_Q1D = Q1D; \
   constexpr int max_DQ = (max_Q1D > max_D1D) ? max_Q1D : max_D1D; \
   double sm0[max_DQ*max_DQ*max_DQ]; \
   double sm1[max_DQ*max_DQ*max_DQ]; \
@@ -275,7 +281,7 @@ Index_type NE = m_NE;
 #define CONVECTION3DPA_2 \
   double Bu_ = 0.0; \
   double Gu_ = 0.0; \
-  for (int dx = 0; dx < CPA_D1D; ++dx) \
+  for (int dx = 0; dx < max_D1D; ++dx) \
   { \
     const double bx = cpa_B(qx,dx); \
     const double gx = cpa_G(qx,dx); \
@@ -290,7 +296,7 @@ Index_type NE = m_NE;
   double BBu_ = 0.0; \
   double GBu_ = 0.0; \
   double BGu_ = 0.0; \
-  for (int dy = 0; dy < CPA_D1D; ++dy) \
+  for (int dy = 0; dy < max_D1D; ++dy) \
   { \
     const double bx = cpa_B(qy,dy); \
     const double gx = cpa_G(qy,dy); \
@@ -306,7 +312,7 @@ Index_type NE = m_NE;
   double GBBu_ = 0.0; \
   double BGBu_ = 0.0; \
   double BBGu_ = 0.0; \
-  for (int dz = 0; dz < CPA_D1D; ++dz) \
+  for (int dz = 0; dz < max_D1D; ++dz) \
   { \
     const double bx = cpa_B(qz,dz); \
     const double gx = cpa_G(qz,dz); \
@@ -329,7 +335,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_6 \
   double BDGu_ = 0.0; \
-  for (int qz = 0; qz < CPA_Q1D; ++qz) \
+  for (int qz = 0; qz < max_Q1D; ++qz) \
   { \
     const double w = cpa_Bt(dz,qz); \
     BDGu_ += w * DGu[qz][qy][qx]; \
@@ -338,7 +344,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_7 \
   double BBDGu_ = 0.0; \
-  for (int qy = 0; qy < CPA_Q1D; ++qy) \
+  for (int qy = 0; qy < max_Q1D; ++qy) \
   { \
     const double w = cpa_Bt(dy,qy); \
     BBDGu_ += w * BDGu[dz][qy][qx]; \
@@ -347,7 +353,7 @@ Index_type NE = m_NE;
 
 #define CONVECTION3DPA_8 \
   double BBBDGu = 0.0; \
-  for (int qx = 0; qx < CPA_Q1D; ++qx) \
+  for (int qx = 0; qx < max_Q1D; ++qx) \
   { \
     const double w = cpa_Bt(dx,qx); \
     BBBDGu += w * BBDGu[dz][dy][qx]; \
@@ -385,6 +391,10 @@ public:
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = CPA_Q1D * CPA_Q1D * CPA_Q1D;
@@ -400,6 +410,9 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
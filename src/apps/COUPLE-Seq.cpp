@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+void COUPLE::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          COUPLE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto couple_lam = [=](Index_type k) {
+                          COUPLE_BODY;
+                        };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          couple_lam(k);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void COUPLE::runSeqVariantSplit(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  COUPLE_SPLIT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          COUPLE_SPLIT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto couple_lam = [=](Index_type k) {
+                          COUPLE_SPLIT_BODY;
+                        };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          couple_lam(k);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
+          COUPLE_SPLIT_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void COUPLE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case 0 : runSeqVariantDefault(vid); break;
+    case 1 : runSeqVariantSplit(vid); break;
+    default : {
+      getCout() << "\n  COUPLE : Unknown Seq tuning id = " << tune_idx << std::endl;
+    }
+  }
+}
+
+void COUPLE::setSeqTuningDefinitions(VariantID vid)
+{
+  addLayoutTuningNames(vid);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
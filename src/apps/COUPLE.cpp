@@ -6,7 +6,7 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
-#include "WIP-COUPLE.hpp"
+#include "COUPLE.hpp"
 
 #include "RAJA/RAJA.hpp"
 
@@ -28,7 +28,7 @@ COUPLE::COUPLE(const RunParams& params)
   setDefaultReps(50);
 
   Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
-  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+  m_domain = new ADomain(rzmax, /* ndims = */ 3, params);
 
   m_imin = m_domain->imin;
   m_imax = m_domain->imax;
@@ -42,14 +42,18 @@ COUPLE::COUPLE(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * m_domain->n_real_zones );
-  setFLOPsPerRep(0);
+  // A complex multiply is counted as 6 flops and sqrt, sin, cos, and the
+  // reciprocal as 1 each; 134 flops per zone in total.
+  setFLOPsPerRep(134 * m_domain->n_real_zones);
 
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 }
 
@@ -58,9 +62,15 @@ COUPLE::~COUPLE()
   delete m_domain;
 }
 
-void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COUPLE::addLayoutTuningNames(VariantID vid)
 {
-  Index_type max_loop_index = m_domain->lrn;
+  addVariantTuningName(vid, "default");
+  addVariantTuningName(vid, "split");
+}
+
+void COUPLE::setUp(VariantID vid, size_t tune_idx)
+{
+  Index_type max_loop_index = m_domain->nnalls;
 
   allocAndInitData(m_t0, max_loop_index, vid);
   allocAndInitData(m_t1, max_loop_index, vid);
@@ -68,6 +78,34 @@ void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   allocAndInitData(m_denac, max_loop_index, vid);
   allocAndInitData(m_denlw, max_loop_index, vid);
 
+  if (tune_idx == 1) {
+
+    allocData(m_t0re, max_loop_index);
+    allocData(m_t0im, max_loop_index);
+    allocData(m_t1re, max_loop_index);
+    allocData(m_t1im, max_loop_index);
+    allocData(m_t2re, max_loop_index);
+    allocData(m_t2im, max_loop_index);
+    allocData(m_denacre, max_loop_index);
+    allocData(m_denacim, max_loop_index);
+    allocData(m_denlwre, max_loop_index);
+    allocData(m_denlwim, max_loop_index);
+
+    for (Index_type i = 0; i < max_loop_index; ++i) {
+      m_t0re[i] = real(m_t0[i]);
+      m_t0im[i] = imag(m_t0[i]);
+      m_t1re[i] = real(m_t1[i]);
+      m_t1im[i] = imag(m_t1[i]);
+      m_t2re[i] = real(m_t2[i]);
+      m_t2im[i] = imag(m_t2[i]);
+      m_denacre[i] = real(m_denac[i]);
+      m_denacim[i] = imag(m_denac[i]);
+      m_denlwre[i] = real(m_denlw[i]);
+      m_denlwim[i] = imag(m_denlw[i]);
+    }
+
+  }
+
   m_clight = 3.e+10;
   m_csound = 3.09e+7;
   m_omega0 = 0.9;
@@ -80,116 +118,24 @@ void COUPLE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   m_ireal = Complex_type(0.0, 1.0);
 }
 
-void COUPLE::runKernel(VariantID vid, size_t tune_idx)
+void COUPLE::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  RAJA_UNUSED_VAR(tune_idx);
-  const Index_type run_reps = getRunReps();
-
-  COUPLE_DATA_SETUP;
-
-  switch ( vid ) {
-
-    case Base_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-
-      break;
-    }
-
-#if defined(RUN_RAJA_SEQ)
-    case RAJA_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::loop_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-    case Base_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        #pragma omp parallel for
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-      break;
-    }
+  Index_type max_loop_index = m_domain->nnalls;
 
-    case RAJA_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_TARGET_OPENMP) && 0
-    case Base_OpenMPTarget :
-    case RAJA_OpenMPTarget :
-    {
-      runOpenMPTargetVariant(vid, tune_idx);
-      break;
+  if (tune_idx == 1) {
+    for (Index_type i = 0; i < max_loop_index; ++i) {
+      m_t0[i] = Complex_type(m_t0re[i], m_t0im[i]);
+      m_t1[i] = Complex_type(m_t1re[i], m_t1im[i]);
+      m_t2[i] = Complex_type(m_t2re[i], m_t2im[i]);
     }
-#endif
-
-#if defined(RAJA_ENABLE_CUDA) && 0
-    case Base_CUDA :
-    case RAJA_CUDA :
-    {
-      runCudaVariant(vid, tune_idx);
-      break;
-    }
-#endif
-
-    default : {
-      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
-    }
-
   }
-}
-
-void COUPLE::updateChecksum(VariantID vid, size_t tune_idx)
-{
-  Index_type max_loop_index = m_domain->lrn;
 
   checksum[vid][tune_idx] += calcChecksum(m_t0, max_loop_index);
   checksum[vid][tune_idx] += calcChecksum(m_t1, max_loop_index);
   checksum[vid][tune_idx] += calcChecksum(m_t2, max_loop_index);
 }
 
-void COUPLE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COUPLE::tearDown(VariantID vid, size_t tune_idx)
 {
   (void) vid;
 
@@ -198,6 +144,19 @@ void COUPLE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_t2);
   deallocData(m_denac);
   deallocData(m_denlw);
+
+  if (tune_idx == 1) {
+    deallocData(m_t0re);
+    deallocData(m_t0im);
+    deallocData(m_t1re);
+    deallocData(m_t1im);
+    deallocData(m_t2re);
+    deallocData(m_t2im);
+    deallocData(m_denacre);
+    deallocData(m_denacim);
+    deallocData(m_denlwre);
+    deallocData(m_denlwim);
+  }
 }
 
 } // end namespace apps
@@ -12,12 +12,11 @@
 /// for (Index_type k = kmin ; k < kmax ; ++k ) {
 ///   for (Index_type j = jmin; j < jmax; j++) {
 ///
-///      Index_type it0=    ((k)*(jmax+1) + (j))*(imax+1) ;
-///      Index_type idenac= ((k)*(jmax+2) + (j))*(imax+2) ;
+///      Index_type it0 = k*kp + j*jp ;
 ///
 ///      for (Index_type i = imin; i < imax; i++) {
 ///
-///         Complex_type c1 = c10 * denac[idenac+i];
+///         Complex_type c1 = c10 * denac[it0+i];
 ///         Complex_type c2 = c20 * denlw[it0+i];
 ///
 ///         /* promote to doubles to avoid possible divide by zero */
@@ -64,39 +63,63 @@
 ///   } /* j loop */
 /// } /* k loop */
 ///
+/// The "split" tuning stores the real and imaginary parts of each complex
+/// array in separate Real_type arrays and writes the complex operations
+/// above out in real arithmetic, in the same order, so that the i loop is
+/// unit stride in every array and may be vectorized.
+///
 
 #ifndef RAJAPerf_Apps_COUPLE_HPP
 #define RAJAPerf_Apps_COUPLE_HPP
 
-#define COUPLE_DATA_SETUP \
-  Complex_ptr t0 = m_t0; \
-  Complex_ptr t1 = m_t1; \
-  Complex_ptr t2 = m_t2; \
-  Complex_ptr denac = m_denac; \
-  Complex_ptr denlw = m_denlw; \
+#define COUPLE_PARAMS_SETUP \
   const Real_type dt = m_dt; \
   const Real_type c10 = m_c10; \
   const Real_type fratio = m_fratio; \
   const Real_type r_fratio = m_r_fratio; \
   const Real_type c20 = m_c20; \
-  const Complex_type ireal = m_ireal; \
  \
   const Index_type imin = m_imin; \
   const Index_type imax = m_imax; \
   const Index_type jmin = m_jmin; \
   const Index_type jmax = m_jmax; \
   const Index_type kmin = m_kmin; \
-  const Index_type kmax = m_kmax;
+  const Index_type kmax = m_kmax; \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define COUPLE_DATA_SETUP \
+  Complex_ptr t0 = m_t0; \
+  Complex_ptr t1 = m_t1; \
+  Complex_ptr t2 = m_t2; \
+  Complex_ptr denac = m_denac; \
+  Complex_ptr denlw = m_denlw; \
+  const Complex_type ireal = m_ireal; \
+  COUPLE_PARAMS_SETUP
+
+#define COUPLE_SPLIT_DATA_SETUP \
+  Real_ptr t0re = m_t0re; \
+  Real_ptr t0im = m_t0im; \
+  Real_ptr t1re = m_t1re; \
+  Real_ptr t1im = m_t1im; \
+  Real_ptr t2re = m_t2re; \
+  Real_ptr t2im = m_t2im; \
+  Real_ptr denacre = m_denacre; \
+  Real_ptr denacim = m_denacim; \
+  Real_ptr denlwre = m_denlwre; \
+  Real_ptr denlwim = m_denlwim; \
+  const Real_type irealre = real(m_ireal); \
+  const Real_type irealim = imag(m_ireal); \
+  COUPLE_PARAMS_SETUP
 
 #define COUPLE_BODY \
 for (Index_type j = jmin; j < jmax; j++) { \
  \
-   Index_type it0=    ((k)*(jmax+1) + (j))*(imax+1) ; \
-   Index_type idenac= ((k)*(jmax+2) + (j))*(imax+2) ; \
+   Index_type it0 = k*kp + j*jp ; \
  \
    for (Index_type i = imin; i < imax; i++) { \
  \
-      Complex_type c1 = c10 * denac[idenac+i]; \
+      Complex_type c1 = c10 * denac[it0+i]; \
       Complex_type c2 = c20 * denlw[it0+i]; \
  \
       /* promote to doubles to avoid possible divide by zero */ \
@@ -142,6 +165,73 @@ for (Index_type j = jmin; j < jmax; j++) { \
  \
 } /* j loop */
 
+#define COUPLE_SPLIT_BODY \
+for (Index_type j = jmin; j < jmax; j++) { \
+ \
+   Index_type it0 = k*kp + j*jp ; \
+ \
+   for (Index_type i = imin; i < imax; i++) { \
+ \
+      Real_type c1re = c10 * denacre[it0+i]; \
+      Real_type c1im = c10 * denacim[it0+i]; \
+      Real_type c2re = c20 * denlwre[it0+i]; \
+      Real_type c2im = c20 * denlwim[it0+i]; \
+ \
+      Real_type zlam = c1re*c1re + c1im*c1im + \
+                       c2re*c2re + c2im*c2im + 1.0e-34; \
+      zlam = sqrt(zlam); \
+      Real_type snlamt = sin(zlam * dt * 0.5); \
+      Real_type cslamt = cos(zlam * dt * 0.5); \
+ \
+      Real_type a0re = t0re[it0+i]; \
+      Real_type a0im = t0im[it0+i]; \
+      Real_type a1re = t1re[it0+i]; \
+      Real_type a1im = t1im[it0+i]; \
+      Real_type a2re = t2re[it0+i] * fratio; \
+      Real_type a2im = t2im[it0+i] * fratio; \
+ \
+      Real_type r_zlam= 1.0/zlam; \
+      c1re *= r_zlam; \
+      c1im *= r_zlam; \
+      c2re *= r_zlam; \
+      c2im *= r_zlam; \
+      Real_type zac1 = c1re*c1re + c1im*c1im; \
+      Real_type zac2 = c2re*c2re + c2im*c2im; \
+ \
+      /* compute new A0 */ \
+      Real_type z3re = ( (c1re*a1re - c1im*a1im) + \
+                         (c2re*a2re - c2im*a2im) ) * snlamt; \
+      Real_type z3im = ( (c1re*a1im + c1im*a1re) + \
+                         (c2re*a2im + c2im*a2re) ) * snlamt; \
+      t0re[it0+i] = a0re * cslamt - (irealre*z3re - irealim*z3im); \
+      t0im[it0+i] = a0im * cslamt - (irealre*z3im + irealim*z3re); \
+ \
+      /* compute new A1, conj(c1) = (c1re, -c1im) */ \
+      Real_type r = zac1 * cslamt + zac2; \
+      Real_type z5re = c2re*a2re - c2im*a2im; \
+      Real_type z5im = c2re*a2im + c2im*a2re; \
+      Real_type z4re = (c1re*z5re + c1im*z5im) * (cslamt-1); \
+      Real_type z4im = (c1re*z5im - c1im*z5re) * (cslamt-1); \
+      z3re = (c1re*a0re + c1im*a0im) * snlamt; \
+      z3im = (c1re*a0im - c1im*a0re) * snlamt; \
+      t1re[it0+i] = a1re * r + z4re - (irealre*z3re - irealim*z3im); \
+      t1im[it0+i] = a1im * r + z4im - (irealre*z3im + irealim*z3re); \
+ \
+      /* compute new A2, conj(c2) = (c2re, -c2im) */ \
+      r = zac1 + zac2 * cslamt; \
+      z5re = c1re*a1re - c1im*a1im; \
+      z5im = c1re*a1im + c1im*a1re; \
+      z4re = (c2re*z5re + c2im*z5im) * (cslamt-1); \
+      z4im = (c2re*z5im - c2im*z5re) * (cslamt-1); \
+      z3re = (c2re*a0re + c2im*a0im) * snlamt; \
+      z3im = (c2re*a0im - c2im*a0re) * snlamt; \
+      t2re[it0+i] = ( a2re * r + z4re - (irealre*z3re - irealim*z3im) ) * r_fratio; \
+      t2im[it0+i] = ( a2im * r + z4im - (irealre*z3im + irealim*z3re) ) * r_fratio; \
+ \
+   } /* i loop */ \
+ \
+} /* j loop */
+
 
 #include "common/KernelBase.hpp"
 
@@ -162,23 +252,51 @@ public:
   ~COUPLE();
 
   void setUp(VariantID vid, size_t tune_idx);
-  void runKernel(VariantID vid, size_t tune_idx);
   void updateChecksum(VariantID vid, size_t tune_idx);
   void tearDown(VariantID vid, size_t tune_idx);
 
-  void runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
-  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {(void) vid;}
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSplit(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSplit(VariantID vid);
 
 private:
+  void addLayoutTuningNames(VariantID vid);
+
   Complex_ptr m_t0;
   Complex_ptr m_t1;
   Complex_ptr m_t2;
   Complex_ptr m_denac;
   Complex_ptr m_denlw;
 
+  Real_ptr m_t0re;
+  Real_ptr m_t0im;
+  Real_ptr m_t1re;
+  Real_ptr m_t1im;
+  Real_ptr m_t2re;
+  Real_ptr m_t2im;
+  Real_ptr m_denacre;
+  Real_ptr m_denacim;
+  Real_ptr m_denlwre;
+  Real_ptr m_denlwim;
+
   Real_type m_clight;
   Real_type m_csound;
   Real_type m_omega0;
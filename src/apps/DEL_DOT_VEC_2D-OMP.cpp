@@ -22,7 +22,7 @@ namespace apps
 {
 
 
-void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -110,5 +110,232 @@ void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void DEL_DOT_VEC_2D::runOpenMPVariantBox(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_BOX_DATA_SETUP;
+
+  NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+  NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+  NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+  auto deldotvec2d_box_lam = [=](Index_type ii, Index_type j) {
+                               DEL_DOT_VEC_2D_BOX_BODY_INDEX;
+                               DEL_DOT_VEC_2D_BODY;
+                             };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = jmin ; j < jmax ; ++j ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            DEL_DOT_VEC_2D_BOX_BODY_INDEX;
+            DEL_DOT_VEC_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = jmin ; j < jmax ; ++j ) {
+          for (Index_type ii = imin ; ii < imax ; ++ii ) {
+            deldotvec2d_box_lam(ii, j);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax},
+                                                 RAJA::RangeSegment{jmin, jmax}),
+                                deldotvec2d_box_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariantIndexSet(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  DEL_DOT_VEC_2D_INDEX_SET_DATA_SETUP;
+
+  NDSET2D(m_domain->jp, x,x1,x2,x3,x4) ;
+  NDSET2D(m_domain->jp, y,y1,y2,y3,y4) ;
+  NDSET2D(m_domain->jp, xdot,fx1,fx2,fx3,fx4) ;
+  NDSET2D(m_domain->jp, ydot,fy1,fy2,fy3,fy4) ;
+
+  auto deldotvec2d_lam = [=](Index_type i) {
+                           DEL_DOT_VEC_2D_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type r = 0 ; r < nrows ; ++r ) {
+          for (Index_type i = row_begins[r] ; i < row_begins[r] + row_len ; ++i ) {
+            DEL_DOT_VEC_2D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type r = 0 ; r < nrows ; ++r ) {
+          for (Index_type i = row_begins[r] ; i < row_begins[r] + row_len ; ++i ) {
+            deldotvec2d_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      RAJA::TypedIndexSet<RAJA::RangeSegment> zones;
+      for (Index_type r = 0 ; r < nrows ; ++r ) {
+        zones.push_back( RAJA::RangeSegment(row_begins[r], row_begins[r] + row_len) );
+      }
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(zones, deldotvec2d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DEL_DOT_VEC_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DEL_DOT_VEC_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  for (size_t iorder = 0; iorder < 4; ++iorder) {
+
+    if (tune_idx == t) {
+
+      // lexicographic, morton, hilbert, and random zone orders, see setUp
+      runOpenMPVariantDefault(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantBox(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantIndexSet(vid);
+
+  }
+
+  t += 1;
+}
+
+void DEL_DOT_VEC_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::morton));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::hilbert));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::random));
+
+  addVariantTuningName(vid, "box");
+
+  addVariantTuningName(vid, "index_set");
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -29,10 +29,13 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   setDefaultReps(100);
 
   Index_type rzmax = std::sqrt(getTargetProblemSize())+1;
-  m_domain = new ADomain(rzmax, /* ndims = */ 2);
+  m_domain = new ADomain(rzmax, /* ndims = */ 2, params);
 
   m_array_length = m_domain->nnalls;
 
+  m_row_begins.resize(m_domain->jmax - m_domain->jmin);
+  setRealZoneRows(m_row_begins.data(), *m_domain);
+
   setActualProblemSize(m_domain->n_real_zones);
 
   setItsPerRep( getActualProblemSize() );
@@ -40,6 +43,14 @@ DEL_DOT_VEC_2D::DEL_DOT_VEC_2D(const RunParams& params)
   setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
                   (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * getItsPerRep() +
                   (0*sizeof(Real_type)  + 4*sizeof(Real_type) ) * (m_domain->imax+1-m_domain->imin)*(m_domain->jmax+1-m_domain->jmin) ) ; // touched data size, not actual number of stores and loads
+  // box and index_set tunings read no zone list, index_set reads one index per row
+  setTuningBytesPerRep( "box",
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * getItsPerRep() +
+                  (0*sizeof(Real_type)  + 4*sizeof(Real_type) ) * (m_domain->imax+1-m_domain->imin)*(m_domain->jmax+1-m_domain->jmin) ) ;
+  setTuningBytesPerRep( "index_set",
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_row_begins.size() +
+                  (1*sizeof(Real_type)  + 0*sizeof(Real_type) ) * getItsPerRep() +
+                  (0*sizeof(Real_type)  + 4*sizeof(Real_type) ) * (m_domain->imax+1-m_domain->imin)*(m_domain->jmax+1-m_domain->jmin) ) ;
   setFLOPsPerRep(54 * m_domain->n_real_zones);
 
   setUsesFeature(Forall);
@@ -69,8 +80,11 @@ DEL_DOT_VEC_2D::~DEL_DOT_VEC_2D()
   delete m_domain;
 }
 
-void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DEL_DOT_VEC_2D::setUp(VariantID vid, size_t tune_idx)
 {
+  setZoneOrder(m_domain->real_zones, m_domain->n_real_zones,
+               getZoneOrder(getVariantTuningName(vid, tune_idx)), *m_domain);
+
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
 
@@ -36,11 +36,19 @@
 ///   div[i] = dfxdx + dfydy + affine ;
 /// }
 ///
+/// The "morton", "hilbert", and "random" CPU tunings sort real_zones in
+/// that order (see setZoneOrder in AppsData.hpp). The mesh data layout is
+/// unchanged.
+///
+/// The "box" CPU tunings iterate the (i,j) box of real zones directly and
+/// the "index_set" tunings iterate one range segment per row of real zones
+/// (a RAJA index set in the RAJA variants); neither reads real_zones.
+///
 
 #ifndef RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 #define RAJAPerf_Apps_DEL_DOT_VEC_2D_HPP
 
-#define DEL_DOT_VEC_2D_DATA_SETUP \
+#define DEL_DOT_VEC_2D_MESH_DATA_SETUP \
   Real_ptr x = m_x; \
   Real_ptr y = m_y; \
   Real_ptr xdot = m_xdot; \
@@ -53,13 +61,35 @@
   Real_ptr x1,x2,x3,x4 ; \
   Real_ptr y1,y2,y3,y4 ; \
   Real_ptr fx1,fx2,fx3,fx4 ; \
-  Real_ptr fy1,fy2,fy3,fy4 ; \
+  Real_ptr fy1,fy2,fy3,fy4 ;
+
+#define DEL_DOT_VEC_2D_DATA_SETUP \
+  DEL_DOT_VEC_2D_MESH_DATA_SETUP \
 \
   Index_ptr real_zones = m_domain->real_zones;
 
 #define DEL_DOT_VEC_2D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
+#define DEL_DOT_VEC_2D_BOX_DATA_SETUP \
+  DEL_DOT_VEC_2D_MESH_DATA_SETUP \
+\
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+  const Index_type jp = m_domain->jp;
+
+#define DEL_DOT_VEC_2D_BOX_BODY_INDEX \
+  Index_type i = ii + j*jp;
+
+#define DEL_DOT_VEC_2D_INDEX_SET_DATA_SETUP \
+  DEL_DOT_VEC_2D_MESH_DATA_SETUP \
+\
+  Index_ptr row_begins = m_row_begins.data(); \
+  const Index_type nrows = m_row_begins.size(); \
+  const Index_type row_len = m_domain->imax - m_domain->imin;
+
 #define DEL_DOT_VEC_2D_BODY \
 \
   Real_type xi  = half * ( x1[i]  + x2[i]  - x3[i]  - x4[i]  ) ; \
@@ -88,6 +118,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -114,8 +146,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBox(VariantID vid);
+  void runSeqVariantIndexSet(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBox(VariantID vid);
+  void runOpenMPVariantIndexSet(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -135,6 +175,7 @@ private:
   Real_type m_half;
 
   ADomain* m_domain;
+  std::vector<Index_type> m_row_begins;
   Index_type m_array_length;
 };
 
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
@@ -23,33 +24,41 @@ namespace apps
 DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
   : KernelBase(rajaperf::Apps_DIFFUSION3DPA, params)
 {
+  m_D1D = DPA_D1D;
+  m_Q1D = DPA_Q1D;
+  if (params.getPAOrder() > 0) {
+    m_D1D = params.getPAOrder() + 1;
+    m_Q1D = params.getPAOrder() + 2;
+  }
+
   m_NE_default = 15625;
 
-  setDefaultProblemSize(m_NE_default*DPA_Q1D*DPA_Q1D*DPA_Q1D);
+  setDefaultProblemSize(m_NE_default*m_Q1D*m_Q1D*m_Q1D);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(DPA_Q1D*DPA_Q1D*DPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(m_Q1D*m_Q1D*m_Q1D), Index_type(1));
 
-  setActualProblemSize( m_NE*DPA_Q1D*DPA_Q1D*DPA_Q1D );
+  setActualProblemSize( m_NE*m_Q1D*m_Q1D*m_Q1D );
 
-  setItsPerRep(getActualProblemSize());
+  // one iteration per degree of freedom, so its/rep / time is DOFs/sec
+  setItsPerRep( m_NE*m_D1D*m_D1D*m_D1D );
   setKernelsPerRep(1);
 
-  setBytesPerRep( 2*DPA_Q1D*DPA_D1D*sizeof(Real_type)  +
-                  DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (DPA_Q1D * DPA_D1D +
-                         5 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         15 * DPA_Q1D * DPA_Q1D * DPA_Q1D +
-                         DPA_Q1D * DPA_D1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         3 * DPA_D1D * DPA_D1D * DPA_D1D));
+  setBytesPerRep( 2*m_Q1D*m_D1D*sizeof(Real_type)  +
+                  m_Q1D*m_Q1D*m_Q1D*SYM*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) +
+                  m_D1D*m_D1D*m_D1D*m_NE*sizeof(Real_type) );
+
+  setFLOPsPerRep(m_NE * (m_Q1D * m_D1D +
+                         5 * m_D1D * m_D1D * m_Q1D * m_D1D +
+                         7 * m_D1D * m_D1D * m_Q1D * m_Q1D +
+                         7 * m_Q1D * m_D1D * m_Q1D * m_Q1D +
+                         15 * m_Q1D * m_Q1D * m_Q1D +
+                         m_Q1D * m_D1D +
+                         7 * m_Q1D * m_Q1D * m_D1D * m_Q1D +
+                         7 * m_Q1D * m_Q1D * m_D1D * m_D1D +
+                         7 * m_D1D * m_Q1D * m_D1D * m_D1D +
+                         3 * m_D1D * m_D1D * m_D1D));
 
   setUsesFeature(Teams);
 
@@ -59,11 +68,14 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
   setVariantDefined( Base_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // GPU variants are only implemented for the default order
+  if (m_D1D == DPA_D1D && m_Q1D == DPA_Q1D) {
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
+  }
 
 }
 
@@ -71,19 +83,56 @@ DIFFUSION3DPA::~DIFFUSION3DPA()
 {
 }
 
-void DIFFUSION3DPA::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFFUSION3DPA::setUp(VariantID vid, size_t tune_idx)
 {
 
-  allocAndInitDataConst(m_B, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(0.0), vid);
+  allocAndInitDataConst(m_B, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_G, int(m_Q1D*m_D1D), Real_type(1.0), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*SYM*m_NE), Real_type(1.0), vid);
+  allocAndInitDataConst(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(1.0), vid);
+
+  if ( isElemBatchTuning(vid, tune_idx) ) {
+
+    //
+    // Replace element data with element-interleaved copies.
+    //
+    const Index_type nbatch = FEM_ELEM_BATCH;
+    const Index_type ne_pad = ((m_NE + nbatch - 1) / nbatch) * nbatch;
+
+    Real_ptr D = nullptr;
+    Real_ptr X = nullptr;
+    allocData(D, int(m_Q1D*m_Q1D*m_Q1D*SYM*ne_pad));
+    allocData(X, int(m_D1D*m_D1D*m_D1D*ne_pad));
+    interleaveElements(D, m_D, m_Q1D*m_Q1D*m_Q1D*SYM, m_NE, nbatch);
+    interleaveElements(X, m_X, m_D1D*m_D1D*m_D1D, m_NE, nbatch);
+    deallocData(m_D);
+    deallocData(m_X);
+    m_D = D;
+    m_X = X;
+    allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*ne_pad), Real_type(0.0), vid);
+
+  } else {
+
+    allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
+
+  }
 }
 
 void DIFFUSION3DPA::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_Y, DPA_D1D*DPA_D1D*DPA_D1D*m_NE);
+  if ( isElemBatchTuning(vid, tune_idx) ) {
+
+    Real_ptr Y = nullptr;
+    allocData(Y, int(m_D1D*m_D1D*m_D1D*m_NE));
+    deinterleaveElements(Y, m_Y, m_D1D*m_D1D*m_D1D, m_NE, FEM_ELEM_BATCH);
+    checksum[vid][tune_idx] += calcChecksum(Y, m_D1D*m_D1D*m_D1D*m_NE);
+    deallocData(Y);
+
+  } else {
+
+    checksum[vid][tune_idx] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
+
+  }
 }
 
 void DIFFUSION3DPA::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -209,6 +209,17 @@
 ///
 /// } // element loop
 ///
+/// The CPU variants are templated on the number of dofs (D1D) and
+/// quadrature points (Q1D) per dimension. The --pa_order option selects
+/// polynomial order p, with D1D = p+1 and Q1D = p+2, for orders 1 to 6;
+/// by default DPA_D1D and DPA_Q1D are used. Iterations per rep count the
+/// dofs, so its/rep divided by the time per rep gives dofs per second.
+///
+/// The elem_batch CPU tunings process FEM_ELEM_BATCH elements at a time
+/// with the element data interleaved (see interleaveElements) so the
+/// element is the innermost, vectorizable loop dimension. The layout
+/// transform is done in setUp and is not timed.
+///
 
 #ifndef RAJAPerf_Apps_DIFFUSION3DPA_HPP
 #define RAJAPerf_Apps_DIFFUSION3DPA_HPP
@@ -231,14 +242,14 @@ const bool symmetric = true;
 #define DPA_D1D 3
 #define DPA_Q1D 4
 #define SYM 6
-#define b(x, y) Basis[x + DPA_Q1D * y]
-#define g(x, y) dBasis[x + DPA_Q1D * y]
+#define b(x, y) Basis[x + MQ1 * y]
+#define g(x, y) dBasis[x + MQ1 * y]
 #define dpaX_(dx, dy, dz, e)                                                      \
-  X[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define dpaY_(dx, dy, dz, e)                                                      \
-  Y[dx + DPA_D1D * dy + DPA_D1D * DPA_D1D * dz + DPA_D1D * DPA_D1D * DPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define d(qx, qy, qz, s, e)                                                    \
-  D[qx + DPA_Q1D * qy + DPA_Q1D * DPA_Q1D * qz + DPA_Q1D * DPA_Q1D * DPA_Q1D * s  +  DPA_Q1D * DPA_Q1D * DPA_Q1D * SYM * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * s  +  MQ1 * MQ1 * MQ1 * SYM * e]
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
 // Indices computation for SmemPADiffusionApply3D.
@@ -295,8 +306,8 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         double (*QDD2)[MD1][MD1] = (double (*)[MD1][MD1]) (sm0+2);
 
 #define DIFFUSION3DPA_0_CPU \
-        constexpr int MQ1 = DPA_Q1D; \
-        constexpr int MD1 = DPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sBG[MQ1*MD1]; \
         double (*B)[MD1] = (double (*)[MD1]) sBG; \
@@ -325,22 +336,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         s_X[dz][dy][dx] = dpaX_(dx,dy,dz,e);
 
 #define DIFFUSION3DPA_2 \
-        const int i = qi(qx,dy,DPA_Q1D); \
-        const int j = dj(qx,dy,DPA_D1D); \
-        const int k = qk(qx,dy,DPA_Q1D); \
-        const int l = dl(qx,dy,DPA_D1D); \
+        const int i = qi(qx,dy,MQ1); \
+        const int j = dj(qx,dy,MD1); \
+        const int k = qk(qx,dy,MQ1); \
+        const int l = dl(qx,dy,MD1); \
         B[i][j] = b(qx,dy); \
         G[k][l] = g(qx,dy) * sign(qx,dy); \
 
 #define DIFFUSION3DPA_3 \
            double u = 0.0, v = 0.0; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dx = 0; dx < DPA_D1D; ++dx) \
+            for (int dx = 0; dx < MD1; ++dx) \
             { \
-               const int i = qi(qx,dx,DPA_Q1D); \
-               const int j = dj(qx,dx,DPA_D1D); \
-               const int k = qk(qx,dx,DPA_Q1D); \
-               const int l = dl(qx,dx,DPA_D1D); \
+               const int i = qi(qx,dx,MQ1); \
+               const int j = dj(qx,dx,MD1); \
+               const int k = qk(qx,dx,MQ1); \
+               const int l = dl(qx,dx,MD1); \
                const double s = sign(qx,dx); \
                const double coords = s_X[dz][dy][dx]; \
                u += coords * B[i][j]; \
@@ -352,12 +363,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_4 \
    double u = 0.0, v = 0.0, w = 0.0; \
    RAJAPERF_UNROLL(MD1)  \
-   for (int dy = 0; dy < DPA_D1D; ++dy) \
+   for (int dy = 0; dy < MD1; ++dy) \
    { \
-      const int i = qi(qy,dy,DPA_Q1D); \
-      const int j = dj(qy,dy,DPA_D1D); \
-      const int k = qk(qy,dy,DPA_Q1D); \
-      const int l = dl(qy,dy,DPA_D1D); \
+      const int i = qi(qy,dy,MQ1); \
+      const int j = dj(qy,dy,MD1); \
+      const int k = qk(qy,dy,MQ1); \
+      const int l = dl(qy,dy,MD1); \
       const double s = sign(qy,dy); \
       u += DDQ1[dz][dy][qx] * B[i][j]; \
       v += DDQ0[dz][dy][qx] * G[k][l] * s; \
@@ -370,12 +381,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_5 \
                double u = 0.0, v = 0.0, w = 0.0; \
                RAJAPERF_UNROLL(MD1) \
-               for (int dz = 0; dz < DPA_D1D; ++dz) \
+               for (int dz = 0; dz < MD1; ++dz) \
                { \
-                  const int i = qi(qz,dz,DPA_Q1D); \
-                  const int j = dj(qz,dz,DPA_D1D); \
-                  const int k = qk(qz,dz,DPA_Q1D); \
-                  const int l = dl(qz,dz,DPA_D1D); \
+                  const int i = qi(qz,dz,MQ1); \
+                  const int j = dj(qz,dz,MD1); \
+                  const int k = qk(qz,dz,MQ1); \
+                  const int l = dl(qz,dz,MD1); \
                   const double s = sign(qz,dz); \
                   u += DQQ0[dz][qy][qx] * B[i][j]; \
                   v += DQQ1[dz][qy][qx] * B[i][j]; \
@@ -398,22 +409,22 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
 
 #define DIFFUSION3DPA_6 \
-               const int i = qi(q,d,DPA_Q1D); \
-               const int j = dj(q,d,DPA_D1D); \
-               const int k = qk(q,d,DPA_Q1D); \
-               const int l = dl(q,d,DPA_D1D); \
+               const int i = qi(q,d,MQ1); \
+               const int j = dj(q,d,MD1); \
+               const int k = qk(q,d,MQ1); \
+               const int l = dl(q,d,MD1); \
                Bt[j][i] = b(q,d); \
                Gt[l][k] = g(q,d) * sign(q,d);
 
 #define DIFFUSION3DPA_7 \
             double u = 0.0, v = 0.0, w = 0.0; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qx = 0; qx < DPA_Q1D; ++qx) \
+            for (int qx = 0; qx < MQ1; ++qx) \
             { \
-              const int i = qi(qx,dx,DPA_Q1D); \
-              const int j = dj(qx,dx,DPA_D1D); \
-              const int k = qk(qx,dx,DPA_Q1D); \
-              const int l = dl(qx,dx,DPA_D1D); \
+              const int i = qi(qx,dx,MQ1); \
+              const int j = dj(qx,dx,MD1); \
+              const int k = qk(qx,dx,MQ1); \
+              const int l = dl(qx,dx,MD1); \
               const double s = sign(qx,dx); \
               u += QQQ0[qz][qy][qx] * Gt[l][k] * s; \
               v += QQQ1[qz][qy][qx] * Bt[j][i]; \
@@ -425,13 +436,13 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 
 #define DIFFUSION3DPA_8 \
         double u = 0.0, v = 0.0, w = 0.0; \
-        RAJAPERF_UNROLL(DPA_Q1D)  \
-        for (int qy = 0; qy < DPA_Q1D; ++qy) \
+        RAJAPERF_UNROLL(MQ1)  \
+        for (int qy = 0; qy < MQ1; ++qy) \
         { \
-          const int i = qi(qy,dy,DPA_Q1D); \
-          const int j = dj(qy,dy,DPA_D1D); \
-          const int k = qk(qy,dy,DPA_Q1D); \
-          const int l = dl(qy,dy,DPA_D1D); \
+          const int i = qi(qy,dy,MQ1); \
+          const int j = dj(qy,dy,MD1); \
+          const int k = qk(qy,dy,MQ1); \
+          const int l = dl(qy,dy,MD1); \
           const double s = sign(qy,dy); \
           u += QQD0[qz][qy][dx] * Bt[j][i]; \
           v += QQD1[qz][qy][dx] * Gt[l][k] * s; \
@@ -444,12 +455,12 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
 #define DIFFUSION3DPA_9 \
         double u = 0.0, v = 0.0, w = 0.0; \
         RAJAPERF_UNROLL(MQ1) \
-        for (int qz = 0; qz < DPA_Q1D; ++qz)  \
+        for (int qz = 0; qz < MQ1; ++qz)  \
         {                                     \
-          const int i = qi(qz,dz,DPA_Q1D); \
-          const int j = dj(qz,dz,DPA_D1D); \
-          const int k = qk(qz,dz,DPA_Q1D); \
-          const int l = dl(qz,dz,DPA_D1D); \
+          const int i = qi(qz,dz,MQ1); \
+          const int j = dj(qz,dz,MD1); \
+          const int k = qk(qz,dz,MQ1); \
+          const int l = dl(qz,dz,MD1); \
           const double s = sign(qz,dz);    \
           u += QDD0[qz][dy][dx] * Bt[j][i];     \
           v += QDD1[qz][dy][dx] * Bt[j][i];     \
@@ -457,6 +468,199 @@ static RAJA_HOST_DEVICE inline double sign(const int q, const int d)
         }                                       \
         dpaY_(dx,dy,dz,e) += (u + v + w);
 
+// Folded B and G (or Bt and Gt) values for quadrature point q and dof d,
+// with the sign applied to the G value
+#define DIFFUSION3DPA_BATCH_BG(q, d) \
+  const double Bqd = B[qi(q,d,MQ1)][dj(q,d,MD1)]; \
+  const double Gqd = G[qk(q,d,MQ1)][dl(q,d,MD1)] * sign(q,d);
+
+#define DIFFUSION3DPA_BATCH_BGT(q, d) \
+  const double Bqd = Bt[dj(q,d,MD1)][qi(q,d,MQ1)]; \
+  const double Gqd = Gt[dl(q,d,MD1)][qk(q,d,MQ1)] * sign(q,d);
+
+// Element batched CPU body for the batch of FEM_ELEM_BATCH elements eb,
+// with X, Y and D in element-interleaved order (see interleaveElements).
+// Each stage matches the corresponding DIFFUSION3DPA_x stage, with the
+// element lane as the innermost loop. B, G, Bt and Gt are built in sBG by
+// DIFFUSION3DPA_2 and DIFFUSION3DPA_6 and read with the same index folding
+// and signs as the default stages (see DIFFUSION3DPA_BATCH_BG/_BGT).
+#define DIFFUSION3DPA_BATCH_BODY \
+  constexpr int MQ1 = Q1D; \
+  constexpr int MD1 = D1D; \
+  constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+  constexpr int W = FEM_ELEM_BATCH; \
+  double sBG[MQ1*MD1]; \
+  double (*B)[MD1] = (double (*)[MD1]) sBG; \
+  double (*G)[MD1] = (double (*)[MD1]) sBG; \
+  double (*Bt)[MQ1] = (double (*)[MQ1]) sBG; \
+  double (*Gt)[MQ1] = (double (*)[MQ1]) sBG; \
+  double sm0[3][MDQ * MDQ * MDQ * W]; \
+  double sm1[3][MDQ * MDQ * MDQ * W]; \
+  const double(*Xb)[MD1][MD1][W] = \
+    (const double(*)[MD1][MD1][W])(X + MD1 * MD1 * MD1 * W * eb); \
+  double(*Yb)[MD1][MD1][W] = \
+    (double(*)[MD1][MD1][W])(Y + MD1 * MD1 * MD1 * W * eb); \
+  const double(*Db)[MQ1][MQ1][MQ1][W] = \
+    (const double(*)[MQ1][MQ1][MQ1][W])(D + MQ1 * MQ1 * MQ1 * SYM * W * eb); \
+  double (*DDQ0)[MD1][MQ1][W] = (double (*)[MD1][MQ1][W]) (sm0+0); \
+  double (*DDQ1)[MD1][MQ1][W] = (double (*)[MD1][MQ1][W]) (sm0+1); \
+  double (*DQQ0)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+0); \
+  double (*DQQ1)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+1); \
+  double (*DQQ2)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm1+2); \
+  double (*QQQ0)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+0); \
+  double (*QQQ1)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+1); \
+  double (*QQQ2)[MQ1][MQ1][W] = (double (*)[MQ1][MQ1][W]) (sm0+2); \
+  double (*QQD0)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+0); \
+  double (*QQD1)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+1); \
+  double (*QQD2)[MQ1][MD1][W] = (double (*)[MQ1][MD1][W]) (sm1+2); \
+  double (*QDD0)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+0); \
+  double (*QDD1)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+1); \
+  double (*QDD2)[MD1][MD1][W] = (double (*)[MD1][MD1][W]) (sm0+2); \
+  for (int dy = 0; dy < MD1; ++dy) { \
+    for (int qx = 0; qx < MQ1; ++qx) { \
+      DIFFUSION3DPA_2; \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W], v[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; } \
+        for (int dx = 0; dx < MD1; ++dx) { \
+          DIFFUSION3DPA_BATCH_BG(qx,dx) \
+          CPU_FOREACH_LANE(l) { \
+            const double coords = Xb[dz][dy][dx][l]; \
+            u[l] += coords * Bqd; \
+            v[l] += coords * Gqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          DDQ0[dz][dy][qx][l] = u[l]; \
+          DDQ1[dz][dy][qx][l] = v[l]; \
+        } \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W], v[W], w[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; } \
+        for (int dy = 0; dy < MD1; ++dy) { \
+          DIFFUSION3DPA_BATCH_BG(qy,dy) \
+          CPU_FOREACH_LANE(l) { \
+            u[l] += DDQ1[dz][dy][qx][l] * Bqd; \
+            v[l] += DDQ0[dz][dy][qx][l] * Gqd; \
+            w[l] += DDQ0[dz][dy][qx][l] * Bqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          DQQ0[dz][qy][qx][l] = u[l]; \
+          DQQ1[dz][qy][qx][l] = v[l]; \
+          DQQ2[dz][qy][qx][l] = w[l]; \
+        } \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W], v[W], w[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; } \
+        for (int dz = 0; dz < MD1; ++dz) { \
+          DIFFUSION3DPA_BATCH_BG(qz,dz) \
+          CPU_FOREACH_LANE(l) { \
+            u[l] += DQQ0[dz][qy][qx][l] * Bqd; \
+            v[l] += DQQ1[dz][qy][qx][l] * Bqd; \
+            w[l] += DQQ2[dz][qy][qx][l] * Gqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          const double O11 = Db[0][qz][qy][qx][l]; \
+          const double O12 = Db[1][qz][qy][qx][l]; \
+          const double O13 = Db[2][qz][qy][qx][l]; \
+          const double O21 = symmetric ? O12 : Db[3][qz][qy][qx][l]; \
+          const double O22 = symmetric ? Db[3][qz][qy][qx][l] : Db[4][qz][qy][qx][l]; \
+          const double O23 = symmetric ? Db[4][qz][qy][qx][l] : Db[5][qz][qy][qx][l]; \
+          const double O31 = symmetric ? O13 : Db[6][qz][qy][qx][l]; \
+          const double O32 = symmetric ? O23 : Db[7][qz][qy][qx][l]; \
+          const double O33 = symmetric ? Db[5][qz][qy][qx][l] : Db[8][qz][qy][qx][l]; \
+          const double gX = u[l]; \
+          const double gY = v[l]; \
+          const double gZ = w[l]; \
+          QQQ0[qz][qy][qx][l] = (O11*gX) + (O12*gY) + (O13*gZ); \
+          QQQ1[qz][qy][qx][l] = (O21*gX) + (O22*gY) + (O23*gZ); \
+          QQQ2[qz][qy][qx][l] = (O31*gX) + (O32*gY) + (O33*gZ); \
+        } \
+      } \
+    } \
+  } \
+  for (int d = 0; d < MD1; ++d) { \
+    for (int q = 0; q < MQ1; ++q) { \
+      DIFFUSION3DPA_6; \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W], v[W], w[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; } \
+        for (int qx = 0; qx < MQ1; ++qx) { \
+          DIFFUSION3DPA_BATCH_BGT(qx,dx) \
+          CPU_FOREACH_LANE(l) { \
+            u[l] += QQQ0[qz][qy][qx][l] * Gqd; \
+            v[l] += QQQ1[qz][qy][qx][l] * Bqd; \
+            w[l] += QQQ2[qz][qy][qx][l] * Bqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          QQD0[qz][qy][dx][l] = u[l]; \
+          QQD1[qz][qy][dx][l] = v[l]; \
+          QQD2[qz][qy][dx][l] = w[l]; \
+        } \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W], v[W], w[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; } \
+        for (int qy = 0; qy < MQ1; ++qy) { \
+          DIFFUSION3DPA_BATCH_BGT(qy,dy) \
+          CPU_FOREACH_LANE(l) { \
+            u[l] += QQD0[qz][qy][dx][l] * Bqd; \
+            v[l] += QQD1[qz][qy][dx][l] * Gqd; \
+            w[l] += QQD2[qz][qy][dx][l] * Bqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          QDD0[qz][dy][dx][l] = u[l]; \
+          QDD1[qz][dy][dx][l] = v[l]; \
+          QDD2[qz][dy][dx][l] = w[l]; \
+        } \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W], v[W], w[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0.0; v[l] = 0.0; w[l] = 0.0; } \
+        for (int qz = 0; qz < MQ1; ++qz) { \
+          DIFFUSION3DPA_BATCH_BGT(qz,dz) \
+          CPU_FOREACH_LANE(l) { \
+            u[l] += QDD0[qz][dy][dx][l] * Bqd; \
+            v[l] += QDD1[qz][dy][dx][l] * Bqd; \
+            w[l] += QDD2[qz][dy][dx][l] * Gqd; \
+          } \
+        } \
+        CPU_FOREACH_LANE(l) { Yb[dz][dy][dx][l] += (u[l] + v[l] + w[l]); } \
+      } \
+    } \
+  }
+
+
 namespace rajaperf
 {
 class RunParams;
@@ -482,14 +686,29 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantElemBatch(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantElemBatch(VariantID vid);
 
 private:
+  static std::string getElemBatchTuningName()
+  { return "elem_batch_" + std::to_string(FEM_ELEM_BATCH); }
+  bool isElemBatchTuning(VariantID vid, size_t tune_idx) const
+  { return getVariantTuningName(vid, tune_idx) == getElemBatchTuningName(); }
+
   static const size_t default_gpu_block_size = DPA_Q1D * DPA_Q1D * DPA_Q1D;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
 
@@ -503,6 +722,9 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
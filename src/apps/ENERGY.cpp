@@ -36,6 +36,9 @@ ENERGY::ENERGY(const RunParams& params)
                   (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() +
                   (1*sizeof(Real_type) + 7*sizeof(Real_type)) * getActualProblemSize() + /* 1 + 12 */
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() ); /* 1 + 8 */
+  // fused tuning streams each zone array once; e_new and q_new are only written
+  setTuningBytesPerRep( "fused",
+                        (2*sizeof(Real_type) + 7*sizeof(Real_type)) * getActualProblemSize() ); /* 2 + 13 */
   setFLOPsPerRep((6  +
                   11 + // 1 sqrt
                   8  +
@@ -83,6 +83,9 @@
 ///   }
 /// }
 ///
+/// The "fused" CPU tunings execute all six loop bodies in a single loop over zones,
+/// so each zone array is streamed once per rep instead of once per loop.
+///
 
 #ifndef RAJAPerf_Apps_ENERGY_HPP
 #define RAJAPerf_Apps_ENERGY_HPP
@@ -176,6 +179,19 @@
      if (fabs(q_new[i]) < q_cut) q_new[i] = 0.0 ; \
   }
 
+//
+// Fused tunings run all bodies in a single pass over the zones. Each body
+// reads only zone i values written by the bodies before it, so the
+// results match the unfused loops exactly.
+//
+#define ENERGY_FUSED_BODY \
+  { ENERGY_BODY1 } \
+  { ENERGY_BODY2 } \
+  { ENERGY_BODY3 } \
+  { ENERGY_BODY4 } \
+  { ENERGY_BODY5 } \
+  { ENERGY_BODY6 }
+
 
 #include "common/KernelBase.hpp"
 
@@ -204,8 +220,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -26,4 +26,28 @@
 
 #define CPU_FOREACH(i, k, N) for (int i = 0; i < N; i++)
 
+// Number of elements processed together by the element batched CPU
+// tunings. Element data is interleaved so that the element is the
+// innermost (SIMD lane) dimension.
+#define FEM_ELEM_BATCH 8
+
+#define CPU_FOREACH_LANE(l) for (int l = 0; l < FEM_ELEM_BATCH; l++)
+
+// Call a variant implementation templated on <D1D, Q1D> for the polynomial
+// orders 1 to 6 selectable with --pa_order (Q1D = D1D + 1). The order is
+// a run option, not a tuning, because it changes the problem itself: the
+// element count, problem size, iterations and FLOPs per rep, and the
+// result all depend on it, and none of these may differ between tunings.
+#define FEM_PA_ORDER_DISPATCH(kernel, impl, d1d, vid) \
+  switch (d1d) { \
+    case 2 : impl<2, 3>(vid); break; \
+    case 3 : impl<3, 4>(vid); break; \
+    case 4 : impl<4, 5>(vid); break; \
+    case 5 : impl<5, 6>(vid); break; \
+    case 6 : impl<6, 7>(vid); break; \
+    case 7 : impl<7, 8>(vid); break; \
+    default : \
+      getCout() << "\n " #kernel " : Unsupported D1D = " << d1d << std::endl; \
+  }
+
 #endif // closing endif for header file include guard
@@ -19,18 +19,14 @@ namespace apps
 {
 
 
-void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < Index_type COEFFLEN >
+void FIR::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize() - m_coefflen;
 
-  FIR_COEFF;
-
-  FIR_DATA_SETUP;
-
-  Real_type coeff[FIR_COEFFLEN];
-  std::copy(std::begin(coeff_array), std::end(coeff_array), std::begin(coeff));
+  FIR_DATA_SETUP_CPU;
 
   auto fir_lam = [=](Index_type i) {
                    FIR_BODY;
@@ -92,5 +88,178 @@ void FIR::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+template < Index_type COEFFLEN >
+void FIR::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP_CPU;
+
+  const Index_type isimd = ibegin +
+    ((iend - ibegin) / FIR_SIMD_WIDTH) * FIR_SIMD_WIDTH;
+
+  auto fir_simd_lam = [=](Index_type i) {
+                        FIR_SIMD_BODY;
+                      };
+  auto fir_lam = [=](Index_type i) {
+                   FIR_BODY;
+                 };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < isimd; i += FIR_SIMD_WIDTH ) {
+          FIR_SIMD_BODY;
+        }
+        for (Index_type i = isimd; i < iend; ++i ) {
+          FIR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < isimd; i += FIR_SIMD_WIDTH ) {
+          fir_simd_lam(i);
+        }
+        for (Index_type i = isimd; i < iend; ++i ) {
+          fir_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeStrideSegment(ibegin, isimd, FIR_SIMD_WIDTH),
+          fir_simd_lam);
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(isimd, iend), fir_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < Index_type COEFFLEN >
+void FIR::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize() - m_coefflen;
+
+  FIR_DATA_SETUP_CPU;
+
+  auto fir_blocked_lam = [=](Index_type i) {
+                           FIR_BLOCKED_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; i += FIR_BLOCK_OUTPUTS ) {
+          FIR_BLOCKED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; i += FIR_BLOCK_OUTPUTS ) {
+          fir_blocked_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeStrideSegment(ibegin, iend, FIR_BLOCK_OUTPUTS),
+          fir_blocked_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIR::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case 0 : FIR_COEFFLEN_DISPATCH(runSeqVariantDefault, m_coefflen, vid); break;
+    case 1 : FIR_COEFFLEN_DISPATCH(runSeqVariantSimd, m_coefflen, vid); break;
+    case 2 : FIR_COEFFLEN_DISPATCH(runSeqVariantBlocked, m_coefflen, vid); break;
+    default : {
+      getCout() << "\n  FIR : Unknown Seq tuning id = " << tune_idx << std::endl;
+    }
+  }
+}
+
+void FIR::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+  addVariantTuningName(vid, "simd");
+  addVariantTuningName(vid, "blocked");
+}
+
 } // end namespace apps
 } // end namespace rajaperf
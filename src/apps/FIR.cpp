@@ -25,6 +25,9 @@ FIR::FIR(const RunParams& params)
   setDefaultReps(160);
 
   m_coefflen = FIR_COEFFLEN;
+  if (params.getFIRCoeffLen() > 0) {
+    m_coefflen = params.getFIRCoeffLen();
+  }
 
   setActualProblemSize( getTargetProblemSize() );
 
@@ -48,14 +51,17 @@ FIR::FIR(const RunParams& params)
   setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 
-  setVariantDefined( Base_OpenMPTarget );
-  setVariantDefined( RAJA_OpenMPTarget );
+  // GPU variants keep the coefficients in FIR_COEFF
+  if (m_coefflen == FIR_COEFFLEN) {
+    setVariantDefined( Base_OpenMPTarget );
+    setVariantDefined( RAJA_OpenMPTarget );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
+  }
 }
 
 FIR::~FIR()
@@ -66,6 +72,11 @@ void FIR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitData(m_in, getActualProblemSize(), vid);
   allocAndInitDataConst(m_out, getActualProblemSize(), 0.0, vid);
+
+  allocData(m_coeff, m_coefflen);
+  for (Index_type j = 0; j < m_coefflen; ++j) {
+    m_coeff[j] = (j % 5 == 0) ? 3.0 : -1.0;
+  }
 }
 
 void FIR::updateChecksum(VariantID vid, size_t tune_idx)
@@ -79,6 +90,7 @@ void FIR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
   deallocData(m_in);
   deallocData(m_out);
+  deallocData(m_coeff);
 }
 
 } // end namespace apps
@@ -24,6 +24,25 @@
 ///   out[i] = sum;
 /// }
 ///
+/// The number of coefficients can be set from 4 to 256 with the
+/// --fir_coefflen option; coefficient j is 3.0 when j is a multiple of 5
+/// and -1.0 otherwise, which matches the array above for the default
+/// length. The CPU variants are specialized at compile time for power of
+/// two lengths (see FIR_COEFFLEN_DISPATCH). FLOPs per rep count one
+/// multiply-add (two FLOPs) per coefficient per output, so the FLOP rate
+/// is twice the MAC rate.
+///
+/// The Seq and OpenMP tunings are
+///   default - one dot product per output, as above
+///   simd    - FIR_SIMD_WIDTH outputs at a time, with the coefficients
+///             held in registers FIR_SIMD_COEFFS at a time and the
+///             outputs as the innermost (vector lane) loop
+///   blocked - tiles of FIR_BLOCK_OUTPUTS outputs that accumulate
+///             FIR_BLOCK_COEFFS coefficients at a time, so the input
+///             window and coefficient block stay in cache for long filters
+/// Each output sums over the coefficients in the same order in every
+/// tuning.
+///
 
 #ifndef RAJAPerf_Apps_FIR_HPP
 #define RAJAPerf_Apps_FIR_HPP
@@ -31,6 +50,12 @@
 
 #define FIR_COEFFLEN (16)
 
+#define FIR_SIMD_WIDTH (8)
+#define FIR_SIMD_COEFFS (4)
+
+#define FIR_BLOCK_OUTPUTS (512)
+#define FIR_BLOCK_COEFFS (64)
+
 #define FIR_DATA_SETUP \
   Real_ptr in = m_in; \
   Real_ptr out = m_out; \
@@ -51,6 +76,86 @@
   } \
   out[i] = sum;
 
+//
+// CPU data setup; coefflen is the compile time length COEFFLEN when it is
+// non-zero and the run time length otherwise.
+//
+#define FIR_DATA_SETUP_CPU \
+  Real_ptr in = m_in; \
+  Real_ptr out = m_out; \
+  Real_ptr coeff = m_coeff; \
+\
+  const Index_type coefflen = (COEFFLEN > 0) ? COEFFLEN : m_coefflen;
+
+// Outputs i to i + FIR_SIMD_WIDTH - 1
+#define FIR_SIMD_BODY \
+  Real_type sum[FIR_SIMD_WIDTH]; \
+  for (Index_type v = 0; v < FIR_SIMD_WIDTH; ++v ) { \
+    sum[v] = 0.0; \
+  } \
+\
+  Index_type j = 0; \
+  for ( ; j + FIR_SIMD_COEFFS <= coefflen; j += FIR_SIMD_COEFFS ) { \
+    Real_type c[FIR_SIMD_COEFFS]; \
+    for (Index_type jj = 0; jj < FIR_SIMD_COEFFS; ++jj ) { \
+      c[jj] = coeff[j+jj]; \
+    } \
+    for (Index_type jj = 0; jj < FIR_SIMD_COEFFS; ++jj ) { \
+      for (Index_type v = 0; v < FIR_SIMD_WIDTH; ++v ) { \
+        sum[v] += c[jj]*in[i+v+j+jj]; \
+      } \
+    } \
+  } \
+  for ( ; j < coefflen; ++j ) { \
+    const Real_type c = coeff[j]; \
+    for (Index_type v = 0; v < FIR_SIMD_WIDTH; ++v ) { \
+      sum[v] += c*in[i+v+j]; \
+    } \
+  } \
+\
+  for (Index_type v = 0; v < FIR_SIMD_WIDTH; ++v ) { \
+    out[i+v] = sum[v]; \
+  }
+
+// Outputs i to min(i + FIR_BLOCK_OUTPUTS, iend) - 1
+#define FIR_BLOCKED_BODY \
+  const Index_type len = std::min(Index_type(FIR_BLOCK_OUTPUTS), iend - i); \
+  Real_type sum[FIR_BLOCK_OUTPUTS]; \
+  for (Index_type ii = 0; ii < len; ++ii ) { \
+    sum[ii] = 0.0; \
+  } \
+\
+  for (Index_type jb = 0; jb < coefflen; jb += FIR_BLOCK_COEFFS ) { \
+    const Index_type jend = std::min(jb + FIR_BLOCK_COEFFS, coefflen); \
+    for (Index_type ii = 0; ii < len; ++ii ) { \
+      Real_type s = sum[ii]; \
+      for (Index_type j = jb; j < jend; ++j ) { \
+        s += coeff[j]*in[i+ii+j]; \
+      } \
+      sum[ii] = s; \
+    } \
+  } \
+\
+  for (Index_type ii = 0; ii < len; ++ii ) { \
+    out[i+ii] = sum[ii]; \
+  }
+
+//
+// Call a variant implementation templated on the number of coefficients,
+// with 0 selecting the run time length.
+//
+#define FIR_COEFFLEN_DISPATCH(impl, coefflen, vid) \
+  switch (coefflen) { \
+    case 4 : impl<4>(vid); break; \
+    case 8 : impl<8>(vid); break; \
+    case 16 : impl<16>(vid); break; \
+    case 32 : impl<32>(vid); break; \
+    case 64 : impl<64>(vid); break; \
+    case 128 : impl<128>(vid); break; \
+    case 256 : impl<256>(vid); break; \
+    default : impl<0>(vid); \
+  }
+
 
 #include "common/KernelBase.hpp"
 
@@ -79,8 +184,22 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runSeqVariantDefault(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runSeqVariantSimd(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runSeqVariantBlocked(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runOpenMPVariantDefault(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runOpenMPVariantSimd(VariantID vid);
+  template < Index_type COEFFLEN >
+  void runOpenMPVariantBlocked(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -92,6 +211,7 @@ private:
 
   Real_ptr m_in;
   Real_ptr m_out;
+  Real_ptr m_coeff;
 
   Index_type m_coefflen;
 };
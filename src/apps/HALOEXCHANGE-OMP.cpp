@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -168,5 +168,157 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+void HALOEXCHANGE::runOpenMPVariantMPI(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  std::vector<Real_ptr> send_buffers = m_send_buffers;
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      auto pack = [&](Index_type l) {
+        Real_ptr buffer = send_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          #pragma omp parallel for
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_PACK_BODY;
+          }
+          buffer += len;
+        }
+      };
+
+      auto unpack = [&](Index_type l) {
+        Real_ptr buffer = recv_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          #pragma omp parallel for
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_UNPACK_BODY;
+          }
+          buffer += len;
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        runMPIExchange(pack, unpack);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = RAJA::omp_parallel_for_exec;
+
+      auto pack = [&](Index_type l) {
+        Real_ptr buffer = send_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_pack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_PACK_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_pack_base_lam );
+          buffer += len;
+        }
+      };
+
+      auto unpack = [&](Index_type l) {
+        Real_ptr buffer = recv_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_unpack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_UNPACK_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_unpack_base_lam );
+          buffer += len;
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        runMPIExchange(pack, unpack);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif
+
+void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (hasMPITunings(vid)) {
+
+    if (tune_idx >= t && tune_idx < t + s_num_mpi_exchanges) {
+
+      runOpenMPVariantMPI(vid);
+
+    }
+
+    t += s_num_mpi_exchanges;
+
+  }
+#endif
+}
+
+void HALOEXCHANGE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (hasMPITunings(vid)) {
+    addMPIExchangeTuningNames(vid);
+  }
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -161,5 +161,152 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+void HALOEXCHANGE::runSeqVariantMPI(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_DATA_SETUP;
+
+  std::vector<Real_ptr> send_buffers = m_send_buffers;
+  std::vector<Real_ptr> recv_buffers = m_recv_buffers;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      auto pack = [&](Index_type l) {
+        Real_ptr buffer = send_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_PACK_BODY;
+          }
+          buffer += len;
+        }
+      };
+
+      auto unpack = [&](Index_type l) {
+        Real_ptr buffer = recv_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_UNPACK_BODY;
+          }
+          buffer += len;
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        runMPIExchange(pack, unpack);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      auto pack = [&](Index_type l) {
+        Real_ptr buffer = send_buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_pack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_PACK_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_pack_base_lam );
+          buffer += len;
+        }
+      };
+
+      auto unpack = [&](Index_type l) {
+        Real_ptr buffer = recv_buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_unpack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_UNPACK_BODY;
+              };
+          RAJA::forall<EXEC_POL>(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_unpack_base_lam );
+          buffer += len;
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        runMPIExchange(pack, unpack);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif
+
+void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (hasMPITunings(vid)) {
+
+    if (tune_idx >= t && tune_idx < t + s_num_mpi_exchanges) {
+
+      runSeqVariantMPI(vid);
+
+    }
+
+    t += s_num_mpi_exchanges;
+
+  }
+#endif
+}
+
+void HALOEXCHANGE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (hasMPITunings(vid)) {
+    addMPIExchangeTuningNames(vid);
+  }
+#endif
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -12,6 +12,7 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace rajaperf
@@ -38,6 +39,40 @@ void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
                           const Index_type num_neighbors,
                           VariantID vid);
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+//
+// Direction of the neighbor each pack index list is sent to and each
+// unpack index list is filled from, matching the ordering of the index
+// list extents below.
+//
+const int neighbor_directions[26][3] = {
+  // faces
+  {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0}, { 0,  1,  0}, { 0,  0, -1}, { 0,  0,  1},
+  // edges
+  {-1, -1,  0}, {-1,  1,  0}, { 1, -1,  0}, { 1,  1,  0},
+  {-1,  0, -1}, {-1,  0,  1}, { 1,  0, -1}, { 1,  0,  1},
+  { 0, -1, -1}, { 0, -1,  1}, { 0,  1, -1}, { 0,  1,  1},
+  // corners
+  {-1, -1, -1}, {-1, -1,  1}, {-1,  1, -1}, {-1,  1,  1},
+  { 1, -1, -1}, { 1, -1,  1}, { 1,  1, -1}, { 1,  1,  1}
+};
+
+//
+// Index of the neighbor in the direction opposite to neighbor l.
+//
+int get_opposite_neighbor(int l)
+{
+  for (int m = 0; m < 26; ++m) {
+    if (neighbor_directions[m][0] == -neighbor_directions[l][0] &&
+        neighbor_directions[m][1] == -neighbor_directions[l][1] &&
+        neighbor_directions[m][2] == -neighbor_directions[l][2]) {
+      return m;
+    }
+  }
+  return -1;
+}
+#endif
+
 }
 
 
@@ -98,13 +133,17 @@ HALOEXCHANGE::HALOEXCHANGE(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  m_mpi_exchange = MPIExchange::none;
+#endif
 }
 
 HALOEXCHANGE::~HALOEXCHANGE()
 {
 }
 
-void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE::setUp(VariantID vid, size_t tune_idx)
 {
   m_vars.resize(m_num_vars, nullptr);
   for (Index_type v = 0; v < m_num_vars; ++v) {
@@ -130,10 +169,25 @@ void HALOEXCHANGE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
     Index_type buffer_len = m_num_vars * m_pack_index_list_lengths[l];
     allocAndInitData(m_buffers[l], buffer_len, vid);
   }
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (hasMPITunings(vid) && tune_idx > 0) {
+    setUpMPIExchange(vid, static_cast<MPIExchange>(tune_idx));
+  }
+#else
+  RAJAPERF_UNUSED_VAR(tune_idx);
+#endif
 }
 
 void HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
 {
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (m_mpi_exchange != MPIExchange::none) {
+    checksum[vid][tune_idx] += calcMPIExchangeChecksum();
+    return;
+  }
+#endif
+
   for (Real_ptr var : m_vars) {
     checksum[vid][tune_idx] += calcChecksum(var, m_var_size);
   }
@@ -141,6 +195,12 @@ void HALOEXCHANGE::updateChecksum(VariantID vid, size_t tune_idx)
 
 void HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  if (m_mpi_exchange != MPIExchange::none) {
+    tearDownMPIExchange(vid);
+  }
+#endif
+
   for (int l = 0; l < s_num_neighbors; ++l) {
     deallocData(m_buffers[l]);
   }
@@ -160,6 +220,167 @@ void HALOEXCHANGE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   m_vars.clear();
 }
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+bool HALOEXCHANGE::hasMPITunings(VariantID vid)
+{
+  return vid == Base_Seq || vid == RAJA_Seq ||
+         vid == Base_OpenMP || vid == RAJA_OpenMP;
+}
+
+//
+// MPI tunings follow the default tuning in the order of MPIExchange.
+//
+void HALOEXCHANGE::addMPIExchangeTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, "mpi_isend_irecv");
+  addVariantTuningName(vid, "mpi_isend_irecv_overlap");
+  addVariantTuningName(vid, "mpi_persistent");
+  addVariantTuningName(vid, "mpi_neighbor_alltoallv");
+}
+
+//
+// Set up the periodic 3d Cartesian rank decomposition, message buffers, and
+// requests or communicators used by the given exchange.
+//
+void HALOEXCHANGE::setUpMPIExchange(VariantID vid, MPIExchange exchange)
+{
+  m_mpi_exchange = exchange;
+
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  int dims[3] = {0, 0, 0};
+  int periods[3] = {1, 1, 1};
+  MPI_Dims_create(num_ranks, 3, dims);
+  MPI_Cart_create(MPI_COMM_WORLD, 3, dims, periods, 0, &m_cart_comm);
+
+  int rank;
+  int coords[3];
+  MPI_Comm_rank(m_cart_comm, &rank);
+  MPI_Cart_coords(m_cart_comm, rank, 3, coords);
+
+  int buffer_len = 0;
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    int neighbor_coords[3];
+    for (int d = 0; d < 3; ++d) {
+      neighbor_coords[d] = coords[d] + neighbor_directions[l][d];
+    }
+    MPI_Cart_rank(m_cart_comm, neighbor_coords, &m_neighbor_ranks[l]);
+    m_opposite_neighbors[l] = get_opposite_neighbor(l);
+
+    m_buffer_counts[l] = m_num_vars * m_pack_index_list_lengths[l];
+    m_buffer_displs[l] = buffer_len;
+    buffer_len += m_buffer_counts[l];
+  }
+
+  allocAndInitData(m_send_buffer, buffer_len, vid);
+  allocAndInitData(m_recv_buffer, buffer_len, vid);
+
+  //
+  // Block l of the receive buffer holds the message sent with tag l, which
+  // fills unpack list m_opposite_neighbors[l].
+  //
+  m_send_buffers.resize(s_num_neighbors, nullptr);
+  m_recv_buffers.resize(s_num_neighbors, nullptr);
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    m_send_buffers[l] = m_send_buffer + m_buffer_displs[l];
+    m_recv_buffers[l] = m_recv_buffer + m_buffer_displs[m_opposite_neighbors[l]];
+  }
+
+  m_send_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+  m_recv_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+
+  if (m_mpi_exchange == MPIExchange::persistent) {
+    for (int l = 0; l < s_num_neighbors; ++l) {
+      MPI_Recv_init(m_recv_buffers[l], m_buffer_counts[m_opposite_neighbors[l]],
+                    Real_MPI_type, m_neighbor_ranks[l], m_opposite_neighbors[l],
+                    m_cart_comm, &m_recv_requests[l]);
+      MPI_Send_init(m_send_buffers[l], m_buffer_counts[l], Real_MPI_type,
+                    m_neighbor_ranks[l], l, m_cart_comm, &m_send_requests[l]);
+    }
+  }
+
+  //
+  // Block l of the neighborhood collective is sent to the neighbor in
+  // direction l and received from the neighbor in the opposite direction,
+  // which sends its block l toward this rank. When a pair of ranks are
+  // neighbors in several directions, as on small periodic decompositions,
+  // both list the blocks they exchange in increasing order of l, so blocks
+  // match as the tags do in the point-to-point exchanges.
+  //
+  if (m_mpi_exchange == MPIExchange::neighbor_alltoallv) {
+    int source_ranks[s_num_neighbors];
+    for (int l = 0; l < s_num_neighbors; ++l) {
+      source_ranks[l] = m_neighbor_ranks[m_opposite_neighbors[l]];
+    }
+    MPI_Dist_graph_create_adjacent(m_cart_comm,
+                                   s_num_neighbors, source_ranks, MPI_UNWEIGHTED,
+                                   s_num_neighbors, m_neighbor_ranks, MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, &m_graph_comm);
+  }
+}
+
+//
+// Every rank initializes the same data, so after a correct exchange unpack
+// list l holds the values of pack list m_opposite_neighbors[l], as in the
+// halo exchange of a single rank in a periodic domain. Those ghost zones are
+// checksummed with the values of pack list l that the exchange without
+// communication leaves there, so correct mpi tunings match the default
+// tuning, and each ghost zone holding another value adds one.
+//
+Checksum_type HALOEXCHANGE::calcMPIExchangeChecksum() const
+{
+  Checksum_type cksum = 0.0;
+  Index_type num_wrong = 0;
+
+  std::vector<Real_type> var_ref(m_var_size);
+  for (Real_ptr var : m_vars) {
+    std::copy(var, var + m_var_size, var_ref.begin());
+    for (int l = 0; l < s_num_neighbors; ++l) {
+      Int_ptr unpack_list = m_unpack_index_lists[l];
+      Int_ptr periodic_list = m_pack_index_lists[m_opposite_neighbors[l]];
+      Int_ptr pack_list = m_pack_index_lists[l];
+      for (Index_type i = 0; i < m_unpack_index_list_lengths[l]; ++i) {
+        if (var[unpack_list[i]] == var[periodic_list[i]]) {
+          var_ref[unpack_list[i]] = var[pack_list[i]];
+        } else {
+          ++num_wrong;
+        }
+      }
+    }
+    cksum += calcChecksum(var_ref.data(), m_var_size);
+  }
+
+  return cksum + num_wrong;
+}
+
+void HALOEXCHANGE::tearDownMPIExchange(VariantID vid)
+{
+  (void) vid;
+
+  if (m_mpi_exchange == MPIExchange::persistent) {
+    for (int l = 0; l < s_num_neighbors; ++l) {
+      MPI_Request_free(&m_recv_requests[l]);
+      MPI_Request_free(&m_send_requests[l]);
+    }
+  }
+  m_send_requests.clear();
+  m_recv_requests.clear();
+
+  if (m_mpi_exchange == MPIExchange::neighbor_alltoallv) {
+    MPI_Comm_free(&m_graph_comm);
+  }
+  MPI_Comm_free(&m_cart_comm);
+
+  m_send_buffers.clear();
+  m_recv_buffers.clear();
+  deallocData(m_send_buffer);
+  deallocData(m_recv_buffer);
+
+  m_mpi_exchange = MPIExchange::none;
+}
+#endif
+
 namespace {
 
 struct Extent
@@ -41,6 +41,24 @@
 ///   }
 /// }
 ///
+/// When built with MPI, the mpi tunings of the Base and RAJA Seq and OpenMP
+/// variants exchange halos on a periodic 3d Cartesian decomposition of
+/// MPI_COMM_WORLD. Pack list l, the interior zones next to the ghost zones of
+/// unpack list l, is sent with tag l to the neighbor in that direction, and
+/// unpack list l is filled from the same neighbor's message in the opposite
+/// direction, with the opposite index as its tag. Pack, communication, and
+/// unpack are timed together:
+///   mpi_isend_irecv         - pack all, MPI_Isend/MPI_Irecv, wait, unpack all.
+///   mpi_isend_irecv_overlap - send each buffer as soon as it is packed and
+///                             unpack each buffer as soon as it arrives.
+///   mpi_persistent          - as the overlap tuning with persistent requests.
+///   mpi_neighbor_alltoallv  - pack all, MPI_Neighbor_alltoallv, unpack all.
+/// The overlap achieved is the difference between the first two tunings.
+/// Every rank initializes the same data, so the mpi tunings are checked
+/// against the halo exchange of a single rank in a periodic domain; ghost
+/// zones holding that result are checksummed as the default tuning leaves
+/// them and each other ghost zone adds one to the checksum.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
@@ -94,6 +112,8 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -101,6 +121,13 @@ public:
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
 
+  void runSeqVariantDefault(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  void runSeqVariantMPI(VariantID vid);
+  void runOpenMPVariantMPI(VariantID vid);
+#endif
+
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
@@ -126,8 +153,150 @@ private:
   std::vector<Index_type > m_pack_index_list_lengths;
   std::vector<Int_ptr> m_unpack_index_lists;
   std::vector<Index_type > m_unpack_index_list_lengths;
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  enum struct MPIExchange
+  {
+    none,
+    isend_irecv,
+    isend_irecv_overlap,
+    persistent,
+    neighbor_alltoallv
+  };
+
+  static const size_t s_num_mpi_exchanges = 4;
+
+  static bool hasMPITunings(VariantID vid);
+  void addMPIExchangeTuningNames(VariantID vid);
+
+  void setUpMPIExchange(VariantID vid, MPIExchange exchange);
+  void tearDownMPIExchange(VariantID vid);
+  Checksum_type calcMPIExchangeChecksum() const;
+
+  //
+  // Run one halo exchange with the given functions packing and unpacking
+  // the buffers of a single neighbor.
+  //
+  template < typename pack_type, typename unpack_type >
+  void runMPIExchange(pack_type&& pack, unpack_type&& unpack);
+
+  MPIExchange m_mpi_exchange;
+
+  MPI_Comm m_cart_comm;
+  MPI_Comm m_graph_comm;
+
+  int m_neighbor_ranks[s_num_neighbors];
+  int m_opposite_neighbors[s_num_neighbors];
+  int m_buffer_counts[s_num_neighbors];
+  int m_buffer_displs[s_num_neighbors];
+
+  Real_ptr m_send_buffer;
+  Real_ptr m_recv_buffer;
+  std::vector<Real_ptr> m_send_buffers;
+  std::vector<Real_ptr> m_recv_buffers;
+
+  std::vector<MPI_Request> m_send_requests;
+  std::vector<MPI_Request> m_recv_requests;
+#endif
 };
 
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+template < typename pack_type, typename unpack_type >
+void HALOEXCHANGE::runMPIExchange(pack_type&& pack, unpack_type&& unpack)
+{
+  const int num_neighbors = s_num_neighbors;
+
+  switch ( m_mpi_exchange ) {
+
+    case MPIExchange::isend_irecv : {
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        MPI_Irecv(m_recv_buffers[l], m_buffer_counts[m_opposite_neighbors[l]],
+                  Real_MPI_type, m_neighbor_ranks[l], m_opposite_neighbors[l],
+                  m_cart_comm, &m_recv_requests[l]);
+      }
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        pack(l);
+      }
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        MPI_Isend(m_send_buffers[l], m_buffer_counts[l], Real_MPI_type,
+                  m_neighbor_ranks[l], l, m_cart_comm, &m_send_requests[l]);
+      }
+
+      MPI_Waitall(num_neighbors, m_recv_requests.data(), MPI_STATUSES_IGNORE);
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        unpack(l);
+      }
+
+      MPI_Waitall(num_neighbors, m_send_requests.data(), MPI_STATUSES_IGNORE);
+
+      break;
+    }
+
+    case MPIExchange::isend_irecv_overlap :
+    case MPIExchange::persistent : {
+
+      const bool persistent = (m_mpi_exchange == MPIExchange::persistent);
+
+      if (persistent) {
+        MPI_Startall(num_neighbors, m_recv_requests.data());
+      } else {
+        for (int l = 0; l < num_neighbors; ++l) {
+          MPI_Irecv(m_recv_buffers[l], m_buffer_counts[m_opposite_neighbors[l]],
+                    Real_MPI_type, m_neighbor_ranks[l], m_opposite_neighbors[l],
+                    m_cart_comm, &m_recv_requests[l]);
+        }
+      }
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        pack(l);
+        if (persistent) {
+          MPI_Start(&m_send_requests[l]);
+        } else {
+          MPI_Isend(m_send_buffers[l], m_buffer_counts[l], Real_MPI_type,
+                    m_neighbor_ranks[l], l, m_cart_comm, &m_send_requests[l]);
+        }
+      }
+
+      for (int n = 0; n < num_neighbors; ++n) {
+        int l = MPI_UNDEFINED;
+        MPI_Waitany(num_neighbors, m_recv_requests.data(), &l, MPI_STATUS_IGNORE);
+        unpack(l);
+      }
+
+      MPI_Waitall(num_neighbors, m_send_requests.data(), MPI_STATUSES_IGNORE);
+
+      break;
+    }
+
+    case MPIExchange::neighbor_alltoallv : {
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        pack(l);
+      }
+
+      MPI_Neighbor_alltoallv(m_send_buffer, m_buffer_counts, m_buffer_displs, Real_MPI_type,
+                             m_recv_buffer, m_buffer_counts, m_buffer_displs, Real_MPI_type,
+                             m_graph_comm);
+
+      for (int l = 0; l < num_neighbors; ++l) {
+        unpack(l);
+      }
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE : Unknown MPI exchange" << std::endl;
+    }
+
+  }
+}
+#endif
+
 } // end namespace apps
 } // end namespace rajaperf
 
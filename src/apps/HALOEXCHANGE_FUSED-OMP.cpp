@@ -18,7 +18,7 @@ namespace apps
 {
 
 
-void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HALOEXCHANGE_FUSED::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -35,20 +35,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type pack_index = 0;
+        HALOEXCHANGE_FUSED_MANUAL_FUSER_PACK_PLAN;
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
-            pack_lens[pack_index] = len;
-            pack_index += 1;
-            buffer += len;
-          }
-        }
 #if _OPENMP >= 200805
         #pragma omp parallel
         #pragma omp single nowait
@@ -77,20 +65,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         }
 #endif
 
-        Index_type unpack_index = 0;
+        HALOEXCHANGE_FUSED_MANUAL_FUSER_UNPACK_PLAN;
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
-            unpack_lens[unpack_index] = len;
-            unpack_index += 1;
-            buffer += len;
-          }
-        }
 #if _OPENMP >= 200805
         #pragma omp parallel
         #pragma omp single nowait
@@ -134,20 +110,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type pack_index = 0;
+        HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_PACK_PLAN;
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            new(&pack_lambdas[pack_index]) pack_lambda_type(make_pack_lambda(buffer, list, var));
-            pack_lens[pack_index] = len;
-            pack_index += 1;
-            buffer += len;
-          }
-        }
 #if _OPENMP >= 200805
         #pragma omp parallel
         #pragma omp single nowait
@@ -172,20 +136,8 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
         }
 #endif
 
-        Index_type unpack_index = 0;
+        HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_UNPACK_PLAN;
 
-        for (Index_type l = 0; l < num_neighbors; ++l) {
-          Real_ptr buffer = buffers[l];
-          Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
-          for (Index_type v = 0; v < num_vars; ++v) {
-            Real_ptr var = vars[v];
-            new(&unpack_lambdas[unpack_index]) unpack_lambda_type(make_unpack_lambda(buffer, list, var));
-            unpack_lens[unpack_index] = len;
-            unpack_index += 1;
-            buffer += len;
-          }
-        }
 #if _OPENMP >= 200805
         #pragma omp parallel
         #pragma omp single nowait
@@ -307,5 +259,375 @@ void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 #endif
 }
 
+void HALOEXCHANGE_FUSED::runOpenMPVariantPersistent(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_PACK_PLAN;
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_UNPACK_PLAN;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < pack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = pack_ptr_holders[j].buffer;
+            Int_ptr    list   = pack_ptr_holders[j].list;
+            Real_ptr   var    = pack_ptr_holders[j].var;
+            Index_type len    = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_PACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr   buffer = pack_ptr_holders[j].buffer;
+          Int_ptr    list   = pack_ptr_holders[j].list;
+          Real_ptr   var    = pack_ptr_holders[j].var;
+          Index_type len    = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_PACK_BODY;
+          }
+        }
+#endif
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < unpack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+            Int_ptr    list   = unpack_ptr_holders[j].list;
+            Real_ptr   var    = unpack_ptr_holders[j].var;
+            Index_type len    = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              HALOEXCHANGE_FUSED_UNPACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+          Int_ptr    list   = unpack_ptr_holders[j].list;
+          Real_ptr   var    = unpack_ptr_holders[j].var;
+          Index_type len    = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            HALOEXCHANGE_FUSED_UNPACK_BODY;
+          }
+        }
+#endif
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_PACK_PLAN;
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_UNPACK_PLAN;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < pack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       pack_lambda = pack_lambdas[j];
+            Index_type len         = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              pack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < pack_index; j++) {
+          auto       pack_lambda = pack_lambdas[j];
+          Index_type len         = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            pack_lambda(i);
+          }
+        }
+#endif
+
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < unpack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       unpack_lambda = unpack_lambdas[j];
+            Index_type len           = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              unpack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < unpack_index; j++) {
+          auto       unpack_lambda = unpack_lambdas[j];
+          Index_type len           = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            unpack_lambda(i);
+          }
+        }
+#endif
+
+      }
+      stopTimer();
+
+      HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::omp_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+      pool_unpack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = pack_index_lists[l];
+        Index_type  len  = pack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_fused_pack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_FUSED_PACK_BODY;
+              };
+          pool_pack.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_fused_pack_base_lam );
+          buffer += len;
+        }
+      }
+      workgroup group_pack = pool_pack.instantiate();
+
+      for (Index_type l = 0; l < num_neighbors; ++l) {
+        Real_ptr buffer = buffers[l];
+        Int_ptr list = unpack_index_lists[l];
+        Index_type  len  = unpack_index_list_lengths[l];
+        for (Index_type v = 0; v < num_vars; ++v) {
+          Real_ptr var = vars[v];
+          auto haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+                HALOEXCHANGE_FUSED_UNPACK_BODY;
+              };
+          pool_unpack.enqueue(
+              RAJA::TypedRangeSegment<Index_type>(0, len),
+              haloexchange_fused_unpack_base_lam );
+          buffer += len;
+        }
+      }
+      workgroup group_unpack = pool_unpack.instantiate();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        group_pack.run();
+
+        group_unpack.run();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariantFlattened(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HALOEXCHANGE_FUSED_FLATTENED_FUSER_SETUP(omp_get_max_threads());
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(static)
+        for (Index_type c = 0; c < num_pack_chunks; ++c) {
+          HALOEXCHANGE_FUSED_FLATTENED_PACK_CHUNK_BODY;
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (Index_type c = 0; c < num_unpack_chunks; ++c) {
+          HALOEXCHANGE_FUSED_FLATTENED_UNPACK_CHUNK_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto haloexchange_fused_pack_chunk_lam = [=](Index_type c) {
+            HALOEXCHANGE_FUSED_FLATTENED_PACK_CHUNK_BODY;
+          };
+      auto haloexchange_fused_unpack_chunk_lam = [=](Index_type c) {
+            HALOEXCHANGE_FUSED_FLATTENED_UNPACK_CHUNK_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for schedule(static)
+        for (Index_type c = 0; c < num_pack_chunks; ++c) {
+          haloexchange_fused_pack_chunk_lam(c);
+        }
+
+        #pragma omp parallel for schedule(static)
+        for (Index_type c = 0; c < num_unpack_chunks; ++c) {
+          haloexchange_fused_unpack_chunk_lam(c);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto haloexchange_fused_pack_chunk_lam = [=](Index_type c) {
+            HALOEXCHANGE_FUSED_FLATTENED_PACK_CHUNK_BODY;
+          };
+      auto haloexchange_fused_unpack_chunk_lam = [=](Index_type c) {
+            HALOEXCHANGE_FUSED_FLATTENED_UNPACK_CHUNK_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::TypedRangeSegment<Index_type>(0, num_pack_chunks),
+            haloexchange_fused_pack_chunk_lam );
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::TypedRangeSegment<Index_type>(0, num_unpack_chunks),
+            haloexchange_fused_unpack_chunk_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantPersistent(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantFlattened(vid);
+
+  }
+
+  t += 1;
+}
+
+void HALOEXCHANGE_FUSED::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, "persistent_plan");
+
+  addVariantTuningName(vid, "flattened_plan");
+}
+
 } // end namespace apps
 } // end namespace rajaperf
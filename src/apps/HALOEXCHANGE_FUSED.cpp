@@ -12,6 +12,7 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
 #include <cmath>
 
 namespace rajaperf
@@ -139,6 +140,54 @@ void HALOEXCHANGE_FUSED::updateChecksum(VariantID vid, size_t tune_idx)
   }
 }
 
+void HALOEXCHANGE_FUSED::createFlattenedPlan(
+    std::vector<flat_item>& items,
+    std::vector<Index_type>& chunk_begins,
+    const std::vector<Int_ptr>& index_lists,
+    const std::vector<Index_type>& index_list_lengths,
+    Index_type num_chunks)
+{
+  Index_type total_len = 0;
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    total_len += m_num_vars * index_list_lengths[l];
+  }
+  const Index_type chunk_len =
+      std::max(Index_type(1), (total_len + num_chunks - 1) / num_chunks);
+
+  //
+  // Walk the (neighbor, variable) items in buffer order and split them at
+  // chunk boundaries, so every chunk but the last covers chunk_len entries.
+  //
+  items.clear();
+  chunk_begins.assign(1, 0);
+
+  Index_type pos = 0;
+  Index_type chunk_end = chunk_len;
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Real_ptr buffer = m_buffers[l];
+    Int_ptr list = index_lists[l];
+    Index_type  len  = index_list_lengths[l];
+    for (Index_type v = 0; v < m_num_vars; ++v) {
+      Real_ptr var = m_vars[v];
+      Index_type offset = 0;
+      while (offset < len) {
+        const Index_type item_len = std::min(len - offset, chunk_end - pos);
+        items.emplace_back(flat_item{buffer + offset, list + offset, var, item_len});
+        offset += item_len;
+        pos += item_len;
+        if (pos == chunk_end) {
+          chunk_begins.emplace_back(items.size());
+          chunk_end += chunk_len;
+        }
+      }
+      buffer += len;
+    }
+  }
+  if (chunk_begins.back() != static_cast<Index_type>(items.size())) {
+    chunk_begins.emplace_back(items.size());
+  }
+}
+
 void HALOEXCHANGE_FUSED::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   for (int l = 0; l < s_num_neighbors; ++l) {
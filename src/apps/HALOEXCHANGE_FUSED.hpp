@@ -41,6 +41,15 @@
 ///   }
 /// }
 ///
+/// The default CPU tunings rebuild the fused plan (the list of buffer,
+/// index list, and variable pointers for each neighbor and variable pair)
+/// in every repetition. The persistent_plan tunings build the plan once
+/// before the timed loop and replay it, so the difference between the two
+/// is the plan construction overhead. The flattened_plan OpenMP tunings
+/// also build the plan once, but split all pack (unpack) items into one
+/// contiguous chunk of equal length per thread, so that threads are not
+/// left idle by the many short per neighbor and variable loops.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_FUSED_HPP
@@ -73,6 +82,36 @@
   delete[] unpack_ptr_holders; \
   delete[] unpack_lens;
 
+#define HALOEXCHANGE_FUSED_MANUAL_FUSER_PACK_PLAN \
+  Index_type pack_index = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Real_ptr buffer = buffers[l]; \
+    Int_ptr list = pack_index_lists[l]; \
+    Index_type  len  = pack_index_list_lengths[l]; \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[v]; \
+      pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var}; \
+      pack_lens[pack_index]        = len; \
+      pack_index += 1; \
+      buffer += len; \
+    } \
+  }
+
+#define HALOEXCHANGE_FUSED_MANUAL_FUSER_UNPACK_PLAN \
+  Index_type unpack_index = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Real_ptr buffer = buffers[l]; \
+    Int_ptr list = unpack_index_lists[l]; \
+    Index_type  len  = unpack_index_list_lengths[l]; \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[v]; \
+      unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var}; \
+      unpack_lens[unpack_index]        = len; \
+      unpack_index += 1; \
+      buffer += len; \
+    } \
+  }
+
 #define HALOEXCHANGE_FUSED_PACK_BODY \
   buffer[i] = var[list[i]];
 
@@ -100,6 +139,74 @@
       malloc(sizeof(unpack_lambda_type) * (num_neighbors * num_vars))); \
   Index_type* unpack_lens = new Index_type[num_neighbors * num_vars];
 
+#define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_PACK_PLAN \
+  Index_type pack_index = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Real_ptr buffer = buffers[l]; \
+    Int_ptr list = pack_index_lists[l]; \
+    Index_type  len  = pack_index_list_lengths[l]; \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[v]; \
+      new(&pack_lambdas[pack_index]) pack_lambda_type(make_pack_lambda(buffer, list, var)); \
+      pack_lens[pack_index] = len; \
+      pack_index += 1; \
+      buffer += len; \
+    } \
+  }
+
+#define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_UNPACK_PLAN \
+  Index_type unpack_index = 0; \
+  for (Index_type l = 0; l < num_neighbors; ++l) { \
+    Real_ptr buffer = buffers[l]; \
+    Int_ptr list = unpack_index_lists[l]; \
+    Index_type  len  = unpack_index_list_lengths[l]; \
+    for (Index_type v = 0; v < num_vars; ++v) { \
+      Real_ptr var = vars[v]; \
+      new(&unpack_lambdas[unpack_index]) unpack_lambda_type(make_unpack_lambda(buffer, list, var)); \
+      unpack_lens[unpack_index] = len; \
+      unpack_index += 1; \
+      buffer += len; \
+    } \
+  }
+
+#define HALOEXCHANGE_FUSED_FLATTENED_FUSER_SETUP(num_chunks) \
+  std::vector<flat_item> pack_items; \
+  std::vector<Index_type> pack_chunk_begins; \
+  createFlattenedPlan(pack_items, pack_chunk_begins, \
+                      m_pack_index_lists, m_pack_index_list_lengths, num_chunks); \
+  const flat_item* pack_item_ptrs = pack_items.data(); \
+  const Index_type* pack_chunk_ptrs = pack_chunk_begins.data(); \
+  const Index_type num_pack_chunks = pack_chunk_begins.size() - 1; \
+  std::vector<flat_item> unpack_items; \
+  std::vector<Index_type> unpack_chunk_begins; \
+  createFlattenedPlan(unpack_items, unpack_chunk_begins, \
+                      m_unpack_index_lists, m_unpack_index_list_lengths, num_chunks); \
+  const flat_item* unpack_item_ptrs = unpack_items.data(); \
+  const Index_type* unpack_chunk_ptrs = unpack_chunk_begins.data(); \
+  const Index_type num_unpack_chunks = unpack_chunk_begins.size() - 1;
+
+#define HALOEXCHANGE_FUSED_FLATTENED_PACK_CHUNK_BODY \
+  for (Index_type j = pack_chunk_ptrs[c]; j < pack_chunk_ptrs[c+1]; ++j) { \
+    Real_ptr   buffer = pack_item_ptrs[j].buffer; \
+    Int_ptr    list   = pack_item_ptrs[j].list; \
+    Real_ptr   var    = pack_item_ptrs[j].var; \
+    Index_type len    = pack_item_ptrs[j].len; \
+    for (Index_type i = 0; i < len; i++) { \
+      HALOEXCHANGE_FUSED_PACK_BODY; \
+    } \
+  }
+
+#define HALOEXCHANGE_FUSED_FLATTENED_UNPACK_CHUNK_BODY \
+  for (Index_type j = unpack_chunk_ptrs[c]; j < unpack_chunk_ptrs[c+1]; ++j) { \
+    Real_ptr   buffer = unpack_item_ptrs[j].buffer; \
+    Int_ptr    list   = unpack_item_ptrs[j].list; \
+    Real_ptr   var    = unpack_item_ptrs[j].var; \
+    Index_type len    = unpack_item_ptrs[j].len; \
+    for (Index_type i = 0; i < len; i++) { \
+      HALOEXCHANGE_FUSED_UNPACK_BODY; \
+    } \
+  }
+
 #define HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN \
   free(pack_lambdas); \
   delete[] pack_lens; \
@@ -138,8 +245,15 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantPersistent(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantPersistent(VariantID vid);
+  void runOpenMPVariantFlattened(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -151,6 +265,19 @@ private:
 
   static const int s_num_neighbors = 26;
 
+  struct flat_item {
+    Real_ptr   buffer;
+    Int_ptr    list;
+    Real_ptr   var;
+    Index_type len;
+  };
+
+  void createFlattenedPlan(std::vector<flat_item>& items,
+                           std::vector<Index_type>& chunk_begins,
+                           const std::vector<Int_ptr>& index_lists,
+                           const std::vector<Index_type>& index_list_lengths,
+                           Index_type num_chunks);
+
   Index_type m_grid_dims[3];
   Index_type m_halo_width;
   Index_type m_num_vars;
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,13 +19,16 @@ namespace apps
 {
 
 
-void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < size_t layout, size_t nest >
+void LTIMES::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
 
-  LTIMES_DATA_SETUP;
+  using LP = ltimes_layout<layout>;
+
+  LTIMES_LAYOUT_DATA_SETUP(LP);
 
   switch ( vid ) {
 
@@ -33,15 +37,64 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type z = 0; z < num_z; ++z ) {
+        if (nest == 0) {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else if (nest == 1) {
+
+          #pragma omp parallel for
           for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
+            for (Index_type z = 0; z < num_z; ++z ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else if (nest == 2) {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
               for (Index_type d = 0; d < num_d; ++d ) {
-                LTIMES_BODY;
+                for (Index_type m = 0; m < num_m; ++m ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type mt = 0; mt < num_m; mt += LTIMES_TILE_M ) {
+                for (Index_type dt = 0; dt < num_d; dt += LTIMES_TILE_D ) {
+                  const Index_type mend = std::min(mt + LTIMES_TILE_M, num_m);
+                  const Index_type dend = std::min(dt + LTIMES_TILE_D, num_d);
+                  for (Index_type m = mt; m < mend; ++m ) {
+                    for (Index_type d = dt; d < dend; ++d ) {
+                      LTIMES_LAYOUT_BODY;
+                    }
+                  }
+                }
               }
             }
           }
+
         }
 
       }
@@ -54,21 +107,70 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
       auto ltimes_base_lam = [=](Index_type d, Index_type z,
                                  Index_type g, Index_type m) {
-                               LTIMES_BODY;
+                               LTIMES_LAYOUT_BODY;
                              };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type z = 0; z < num_z; ++z ) {
+        if (nest == 0) {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
+              }
+            }
+          }
+
+        } else if (nest == 1) {
+
+          #pragma omp parallel for
           for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
+            for (Index_type z = 0; z < num_z; ++z ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
+              }
+            }
+          }
+
+        } else if (nest == 2) {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
               for (Index_type d = 0; d < num_d; ++d ) {
-                ltimes_base_lam(d, z, g, m);
+                for (Index_type m = 0; m < num_m; ++m ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
+              }
+            }
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type mt = 0; mt < num_m; mt += LTIMES_TILE_M ) {
+                for (Index_type dt = 0; dt < num_d; dt += LTIMES_TILE_D ) {
+                  const Index_type mend = std::min(mt + LTIMES_TILE_M, num_m);
+                  const Index_type dend = std::min(dt + LTIMES_TILE_D, num_d);
+                  for (Index_type m = mt; m < mend; ++m ) {
+                    for (Index_type d = dt; d < dend; ++d ) {
+                      ltimes_base_lam(d, z, g, m);
+                    }
+                  }
+                }
               }
             }
           }
+
         }
 
       }
@@ -79,24 +181,13 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
     case RAJA_OpenMP : {
 
-      LTIMES_VIEWS_RANGES_RAJA;
+      LTIMES_LAYOUT_VIEWS_RANGES_RAJA(LP);
 
       auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
                           LTIMES_BODY_RAJA;
                         };
 
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::omp_parallel_for_exec, // z
-            RAJA::statement::For<2, RAJA::loop_exec,           // g
-              RAJA::statement::For<3, RAJA::loop_exec,         // m
-                RAJA::statement::For<0, RAJA::loop_exec,       // d
-                  RAJA::statement::Lambda<0>
-                >
-              >
-            >
-          >
-        >;
+      using EXEC_POL = typename ltimes_nest<nest, RAJA::omp_parallel_for_exec>::policy;
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -125,5 +216,31 @@ void LTIMES::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #endif
 }
 
+void LTIMES::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case  0 : runOpenMPVariantImpl<0, 0>(vid); break;
+    case  1 : runOpenMPVariantImpl<0, 1>(vid); break;
+    case  2 : runOpenMPVariantImpl<0, 2>(vid); break;
+    case  3 : runOpenMPVariantImpl<0, 3>(vid); break;
+    case  4 : runOpenMPVariantImpl<1, 0>(vid); break;
+    case  5 : runOpenMPVariantImpl<1, 1>(vid); break;
+    case  6 : runOpenMPVariantImpl<1, 2>(vid); break;
+    case  7 : runOpenMPVariantImpl<1, 3>(vid); break;
+    case  8 : runOpenMPVariantImpl<2, 0>(vid); break;
+    case  9 : runOpenMPVariantImpl<2, 1>(vid); break;
+    case 10 : runOpenMPVariantImpl<2, 2>(vid); break;
+    case 11 : runOpenMPVariantImpl<2, 3>(vid); break;
+    default : {
+      getCout() << "\n  LTIMES : Unknown OpenMP tuning id = " << tune_idx << std::endl;
+    }
+  }
+}
+
+void LTIMES::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addLayoutTuningNames(vid);
+}
+
 } // end namespace apps
 } // end namespace rajaperf
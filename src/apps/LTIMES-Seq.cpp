@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,11 +19,14 @@ namespace apps
 {
 
 
-void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < size_t layout, size_t nest >
+void LTIMES::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  LTIMES_DATA_SETUP;
+  using LP = ltimes_layout<layout>;
+
+  LTIMES_LAYOUT_DATA_SETUP(LP);
 
   switch ( vid ) {
 
@@ -31,14 +35,60 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
+        if (nest == 0) {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else if (nest == 1) {
+
           for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
+            for (Index_type z = 0; z < num_z; ++z ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else if (nest == 2) {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
               for (Index_type d = 0; d < num_d; ++d ) {
-                LTIMES_BODY;
+                for (Index_type m = 0; m < num_m; ++m ) {
+                  LTIMES_LAYOUT_BODY;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type mt = 0; mt < num_m; mt += LTIMES_TILE_M ) {
+                for (Index_type dt = 0; dt < num_d; dt += LTIMES_TILE_D ) {
+                  const Index_type mend = std::min(mt + LTIMES_TILE_M, num_m);
+                  const Index_type dend = std::min(dt + LTIMES_TILE_D, num_d);
+                  for (Index_type m = mt; m < mend; ++m ) {
+                    for (Index_type d = dt; d < dend; ++d ) {
+                      LTIMES_LAYOUT_BODY;
+                    }
+                  }
+                }
               }
             }
           }
+
         }
 
       }
@@ -52,20 +102,66 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
       auto ltimes_base_lam = [=](Index_type d, Index_type z,
                                  Index_type g, Index_type m) {
-                               LTIMES_BODY;
+                               LTIMES_LAYOUT_BODY;
                              };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type z = 0; z < num_z; ++z ) {
+        if (nest == 0) {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
+              }
+            }
+          }
+
+        } else if (nest == 1) {
+
           for (Index_type g = 0; g < num_g; ++g ) {
-            for (Index_type m = 0; m < num_m; ++m ) {
+            for (Index_type z = 0; z < num_z; ++z ) {
+              for (Index_type m = 0; m < num_m; ++m ) {
+                for (Index_type d = 0; d < num_d; ++d ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
+              }
+            }
+          }
+
+        } else if (nest == 2) {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
               for (Index_type d = 0; d < num_d; ++d ) {
-                ltimes_base_lam(d, z, g, m);
+                for (Index_type m = 0; m < num_m; ++m ) {
+                  ltimes_base_lam(d, z, g, m);
+                }
               }
             }
           }
+
+        } else {
+
+          for (Index_type z = 0; z < num_z; ++z ) {
+            for (Index_type g = 0; g < num_g; ++g ) {
+              for (Index_type mt = 0; mt < num_m; mt += LTIMES_TILE_M ) {
+                for (Index_type dt = 0; dt < num_d; dt += LTIMES_TILE_D ) {
+                  const Index_type mend = std::min(mt + LTIMES_TILE_M, num_m);
+                  const Index_type dend = std::min(dt + LTIMES_TILE_D, num_d);
+                  for (Index_type m = mt; m < mend; ++m ) {
+                    for (Index_type d = dt; d < dend; ++d ) {
+                      ltimes_base_lam(d, z, g, m);
+                    }
+                  }
+                }
+              }
+            }
+          }
+
         }
 
       }
@@ -76,25 +172,13 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     case RAJA_Seq : {
 
-      LTIMES_VIEWS_RANGES_RAJA;
+      LTIMES_LAYOUT_VIEWS_RANGES_RAJA(LP);
 
       auto ltimes_lam = [=](ID d, IZ z, IG g, IM m) {
                           LTIMES_BODY_RAJA;
                         };
 
-
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::For<1, RAJA::loop_exec,       // z
-            RAJA::statement::For<2, RAJA::loop_exec,     // g
-              RAJA::statement::For<3, RAJA::loop_exec,   // m
-                RAJA::statement::For<0, RAJA::loop_exec, // d
-                  RAJA::statement::Lambda<0>
-                >
-              >
-            >
-          >
-        >;
+      using EXEC_POL = typename ltimes_nest<nest, RAJA::loop_exec>::policy;
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -121,5 +205,31 @@ void LTIMES::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+void LTIMES::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case  0 : runSeqVariantImpl<0, 0>(vid); break;
+    case  1 : runSeqVariantImpl<0, 1>(vid); break;
+    case  2 : runSeqVariantImpl<0, 2>(vid); break;
+    case  3 : runSeqVariantImpl<0, 3>(vid); break;
+    case  4 : runSeqVariantImpl<1, 0>(vid); break;
+    case  5 : runSeqVariantImpl<1, 1>(vid); break;
+    case  6 : runSeqVariantImpl<1, 2>(vid); break;
+    case  7 : runSeqVariantImpl<1, 3>(vid); break;
+    case  8 : runSeqVariantImpl<2, 0>(vid); break;
+    case  9 : runSeqVariantImpl<2, 1>(vid); break;
+    case 10 : runSeqVariantImpl<2, 2>(vid); break;
+    case 11 : runSeqVariantImpl<2, 3>(vid); break;
+    default : {
+      getCout() << "\n  LTIMES : Unknown Seq tuning id = " << tune_idx << std::endl;
+    }
+  }
+}
+
+void LTIMES::setSeqTuningDefinitions(VariantID vid)
+{
+  addLayoutTuningNames(vid);
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -83,16 +83,66 @@ LTIMES::~LTIMES()
 {
 }
 
-void LTIMES::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void LTIMES::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_phidat, int(m_philen), Real_type(0.0), vid);
   allocAndInitData(m_elldat, int(m_elllen), vid);
   allocAndInitData(m_psidat, int(m_psilen), vid);
+
+  const size_t layout = getLayoutIndex(vid, tune_idx);
+
+  if (layout != 0) {
+
+    //
+    // Store psi in the tuning's order; the values of psi(z, g, d) are the
+    // same for every layout.
+    //
+    const std::array<Index_type, 3> strides =
+      getLayoutStrides(getLayoutPerm(layout), {{m_num_z, m_num_g, m_num_d}});
+
+    Real_ptr psidat = nullptr;
+    allocData(psidat, int(m_psilen));
+    for (Index_type z = 0; z < m_num_z; ++z ) {
+      for (Index_type g = 0; g < m_num_g; ++g ) {
+        for (Index_type d = 0; d < m_num_d; ++d ) {
+          psidat[z*strides[0] + g*strides[1] + d*strides[2]] =
+            m_psidat[d + (g * m_num_d) + (z * m_num_d * m_num_g)];
+        }
+      }
+    }
+    deallocData(m_psidat);
+    m_psidat = psidat;
+
+  }
 }
 
 void LTIMES::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor );
+  const size_t layout = getLayoutIndex(vid, tune_idx);
+
+  if (layout != 0) {
+
+    const std::array<Index_type, 3> strides =
+      getLayoutStrides(getLayoutPerm(layout), {{m_num_z, m_num_g, m_num_m}});
+
+    Real_ptr phidat = nullptr;
+    allocData(phidat, int(m_philen));
+    for (Index_type z = 0; z < m_num_z; ++z ) {
+      for (Index_type g = 0; g < m_num_g; ++g ) {
+        for (Index_type m = 0; m < m_num_m; ++m ) {
+          phidat[m + (g * m_num_m) + (z * m_num_m * m_num_g)] =
+            m_phidat[z*strides[0] + g*strides[1] + m*strides[2]];
+        }
+      }
+    }
+    checksum[vid][tune_idx] += calcChecksum(phidat, m_philen, checksum_scale_factor );
+    deallocData(phidat);
+
+  } else {
+
+    checksum[vid][tune_idx] += calcChecksum(m_phidat, m_philen, checksum_scale_factor );
+
+  }
 }
 
 void LTIMES::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -104,5 +154,54 @@ void LTIMES::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_psidat);
 }
 
+void LTIMES::addLayoutTuningNames(VariantID vid)
+{
+  const std::array<std::string, s_num_layouts> layout_names{{
+      ltimes_layout<0>::name(), ltimes_layout<1>::name(),
+      ltimes_layout<2>::name() }};
+  const std::array<std::string, s_num_nests> nest_names{{
+      ltimes_nest<0, RAJA::loop_exec>::name(),
+      ltimes_nest<1, RAJA::loop_exec>::name(),
+      ltimes_nest<2, RAJA::loop_exec>::name(),
+      ltimes_nest<3, RAJA::loop_exec>::name() }};
+
+  for (std::string const& layout_name : layout_names) {
+    for (std::string const& nest_name : nest_names) {
+      addVariantTuningName(vid, "layout_" + layout_name + "_nest_" + nest_name);
+    }
+  }
+}
+
+size_t LTIMES::getLayoutIndex(VariantID vid, size_t tune_idx) const
+{
+  //
+  // Only the Seq and OpenMP variants have layout tunings, ordered by
+  // layout and then by loop nest.
+  //
+  return isVariantGPU(vid) ? 0 : tune_idx / s_num_nests;
+}
+
+std::array<Index_type, 3> LTIMES::getLayoutPerm(size_t layout)
+{
+  switch (layout) {
+    case 1 : return RAJA::as_array<ltimes_layout<1>::perm>::get();
+    case 2 : return RAJA::as_array<ltimes_layout<2>::perm>::get();
+    default : return RAJA::as_array<ltimes_layout<0>::perm>::get();
+  }
+}
+
+std::array<Index_type, 3> LTIMES::getLayoutStrides(
+    std::array<Index_type, 3> const& perm,
+    std::array<Index_type, 3> const& extents)
+{
+  std::array<Index_type, 3> strides;
+  Index_type stride = 1;
+  for (Index_type i = 2; i >= 0; --i) {
+    strides[perm[i]] = stride;
+    stride *= extents[perm[i]];
+  }
+  return strides;
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -26,6 +26,12 @@
 /// and views to do the same thing without explicit index calculations (see
 /// the loop body definitions below).
 ///
+/// The Seq and OpenMP tunings select the storage order of psi and phi
+/// (zone-, group- or direction-major, see ltimes_layout) and the loop
+/// nesting order, including a nest that tiles the m/d contraction (see
+/// ltimes_nest). Each phi entry accumulates over d in increasing order in
+/// every nest, so all tunings give the same result.
+///
 
 #ifndef RAJAPerf_Apps_LTIMES_HPP
 #define RAJAPerf_Apps_LTIMES_HPP
@@ -49,38 +55,72 @@
 
 
 #define LTIMES_VIEWS_RANGES_RAJA \
+  LTIMES_LAYOUT_VIEWS_RANGES_RAJA(ltimes_layout<0>)
+
+#define LTIMES_LAYOUT_VIEWS_RANGES_RAJA(LP) \
   using namespace ltimes_idx; \
 \
   using PSI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, LP::stride_one>, \
                                    IZ, IG, ID>; \
   using ELL_VIEW = RAJA::TypedView<Real_type, \
                                    RAJA::Layout<2, Index_type, 1>, \
                                    IM, ID>; \
   using PHI_VIEW = RAJA::TypedView<Real_type, \
-                                   RAJA::Layout<3, Index_type, 2>, \
+                                   RAJA::Layout<3, Index_type, LP::stride_one>, \
                                    IZ, IG, IM>; \
 \
   PSI_VIEW psi(psidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_d}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<typename LP::perm>::get() ) ); \
   ELL_VIEW ell(elldat, \
                RAJA::make_permuted_layout( {{num_m, num_d}}, \
                      RAJA::as_array<RAJA::Perm<0, 1> >::get() ) ); \
   PHI_VIEW phi(phidat, \
                RAJA::make_permuted_layout( {{num_z, num_g, num_m}}, \
-                     RAJA::as_array<RAJA::Perm<0, 1, 2> >::get() ) ); \
+                     RAJA::as_array<typename LP::perm>::get() ) ); \
 \
       using IDRange = RAJA::TypedRangeSegment<ID>; \
       using IZRange = RAJA::TypedRangeSegment<IZ>; \
       using IGRange = RAJA::TypedRangeSegment<IG>; \
       using IMRange = RAJA::TypedRangeSegment<IM>;
 
+//
+// Strides of psi and phi for the storage order of the layout LP, with
+// the stride-one dimension a compile time constant.
+//
+#define LTIMES_LAYOUT_DATA_SETUP(LP) \
+  LTIMES_DATA_SETUP; \
+\
+  const std::array<Index_type, 3> psi_strides = \
+    getLayoutStrides(RAJA::as_array<typename LP::perm>::get(), \
+                     {{num_z, num_g, num_d}}); \
+  const std::array<Index_type, 3> phi_strides = \
+    getLayoutStrides(RAJA::as_array<typename LP::perm>::get(), \
+                     {{num_z, num_g, num_m}}); \
+  const Index_type psi_sz = (LP::stride_one == 0) ? 1 : psi_strides[0]; \
+  const Index_type psi_sg = (LP::stride_one == 1) ? 1 : psi_strides[1]; \
+  const Index_type psi_sd = (LP::stride_one == 2) ? 1 : psi_strides[2]; \
+  const Index_type phi_sz = (LP::stride_one == 0) ? 1 : phi_strides[0]; \
+  const Index_type phi_sg = (LP::stride_one == 1) ? 1 : phi_strides[1]; \
+  const Index_type phi_sm = (LP::stride_one == 2) ? 1 : phi_strides[2];
+
+#define LTIMES_LAYOUT_BODY \
+  phidat[z * phi_sz + g * phi_sg + m * phi_sm] += \
+    elldat[d+ (m * num_d)] * psidat[z * psi_sz + g * psi_sg + d * psi_sd];
+
+// Tile sizes for the m/d contraction in the tiled loop nest
+#define LTIMES_TILE_M 5
+#define LTIMES_TILE_D 16
+
 
 #include "common/KernelBase.hpp"
 
 #include "RAJA/RAJA.hpp"
 
+#include <array>
+#include <string>
+
 namespace rajaperf
 {
 class RunParams;
@@ -99,6 +139,115 @@ namespace ltimes_idx {
   RAJA_INDEX_VALUE(IM, "IM");
 }
 
+//
+// Storage orders of psi(z, g, d) and phi(z, g, m) as RAJA permutations
+// (slowest to fastest varying index) with their stride-one dimension.
+//
+template < size_t layout >
+struct ltimes_layout;
+
+template < >
+struct ltimes_layout<0> {   // zone-major
+  using perm = RAJA::Perm<0, 1, 2>;
+  static constexpr camp::idx_t stride_one = 2;
+  static std::string name() { return "zgd"; }
+};
+
+template < >
+struct ltimes_layout<1> {   // group-major
+  using perm = RAJA::Perm<1, 0, 2>;
+  static constexpr camp::idx_t stride_one = 2;
+  static std::string name() { return "gzd"; }
+};
+
+template < >
+struct ltimes_layout<2> {   // direction-major
+  using perm = RAJA::Perm<2, 0, 1>;
+  static constexpr camp::idx_t stride_one = 1;
+  static std::string name() { return "dzg"; }
+};
+
+//
+// Loop nesting orders, outermost first, as RAJA kernel policies for the
+// segment tuple (d, z, g, m). The outermost loop uses outer_policy.
+//
+template < size_t nest, typename outer_policy >
+struct ltimes_nest;
+
+template < typename outer_policy >
+struct ltimes_nest<0, outer_policy> {
+  using policy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, outer_policy,             // z
+        RAJA::statement::For<2, RAJA::loop_exec,        // g
+          RAJA::statement::For<3, RAJA::loop_exec,      // m
+            RAJA::statement::For<0, RAJA::loop_exec,    // d
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+  static std::string name() { return "zgmd"; }
+};
+
+template < typename outer_policy >
+struct ltimes_nest<1, outer_policy> {
+  using policy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<2, outer_policy,             // g
+        RAJA::statement::For<1, RAJA::loop_exec,        // z
+          RAJA::statement::For<3, RAJA::loop_exec,      // m
+            RAJA::statement::For<0, RAJA::loop_exec,    // d
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+  static std::string name() { return "gzmd"; }
+};
+
+template < typename outer_policy >
+struct ltimes_nest<2, outer_policy> {
+  using policy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, outer_policy,             // z
+        RAJA::statement::For<2, RAJA::loop_exec,        // g
+          RAJA::statement::For<0, RAJA::loop_exec,      // d
+            RAJA::statement::For<3, RAJA::loop_exec,    // m
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >;
+  static std::string name() { return "zgdm"; }
+};
+
+template < typename outer_policy >
+struct ltimes_nest<3, outer_policy> {
+  using policy =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, outer_policy,             // z
+        RAJA::statement::For<2, RAJA::loop_exec,        // g
+          RAJA::statement::Tile<3, RAJA::tile_fixed<LTIMES_TILE_M>,
+                                   RAJA::loop_exec,     // m tile
+            RAJA::statement::Tile<0, RAJA::tile_fixed<LTIMES_TILE_D>,
+                                     RAJA::loop_exec,   // d tile
+              RAJA::statement::For<3, RAJA::loop_exec,  // m
+                RAJA::statement::For<0, RAJA::loop_exec,// d
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >
+      >
+    >;
+  static std::string name() { return "zgmd_tiled"; }
+};
+
 class LTIMES : public KernelBase
 {
 public:
@@ -117,14 +266,31 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  template < size_t layout, size_t nest >
+  void runSeqVariantImpl(VariantID vid);
+  template < size_t layout, size_t nest >
+  void runOpenMPVariantImpl(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
 
 private:
+  static const size_t s_num_layouts = 3;
+  static const size_t s_num_nests = 4;
+
+  void addLayoutTuningNames(VariantID vid);
+  size_t getLayoutIndex(VariantID vid, size_t tune_idx) const;
+
+  static std::array<Index_type, 3> getLayoutPerm(size_t layout);
+  static std::array<Index_type, 3> getLayoutStrides(
+      std::array<Index_type, 3> const& perm,
+      std::array<Index_type, 3> const& extents);
+
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
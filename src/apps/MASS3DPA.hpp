@@ -151,6 +151,17 @@
 ///
 /// } // element loop
 ///
+/// The CPU variants are templated on the number of dofs (D1D) and
+/// quadrature points (Q1D) per dimension. The --pa_order option selects
+/// polynomial order p, with D1D = p+1 and Q1D = p+2, for orders 1 to 6;
+/// by default MPA_D1D and MPA_Q1D are used. Iterations per rep count the
+/// dofs, so its/rep divided by the time per rep gives dofs per second.
+///
+/// The elem_batch CPU tunings process FEM_ELEM_BATCH elements at a time
+/// with the element data interleaved (see interleaveElements) so the
+/// element is the innermost, vectorizable loop dimension. The layout
+/// transform is done in setUp and is not timed.
+///
 
 #ifndef RAJAPerf_Apps_MASS3DPA_HPP
 #define RAJAPerf_Apps_MASS3DPA_HPP
@@ -171,18 +182,18 @@ Index_type NE = m_NE;
 //Number of Dofs/Qpts in 1D
 #define MPA_D1D 4
 #define MPA_Q1D 5
-#define B_(x, y) B[x + MPA_Q1D * y]
-#define Bt_(x, y) Bt[x + MPA_D1D * y]
+#define B_(x, y) B[x + MQ1 * y]
+#define Bt_(x, y) Bt[x + MD1 * y]
 #define X_(dx, dy, dz, e)                                                      \
-  X[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  X[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define Y_(dx, dy, dz, e)                                                      \
-  Y[dx + MPA_D1D * dy + MPA_D1D * MPA_D1D * dz + MPA_D1D * MPA_D1D * MPA_D1D * e]
+  Y[dx + MD1 * dy + MD1 * MD1 * dz + MD1 * MD1 * MD1 * e]
 #define D_(qx, qy, qz, e)                                                      \
-  D[qx + MPA_Q1D * qy + MPA_Q1D * MPA_Q1D * qz + MPA_Q1D * MPA_Q1D * MPA_Q1D * e]
+  D[qx + MQ1 * qy + MQ1 * MQ1 * qz + MQ1 * MQ1 * MQ1 * e]
 
 #define MASS3DPA_0_CPU           \
-        constexpr int MQ1 = MPA_Q1D; \
-        constexpr int MD1 = MPA_D1D; \
+        constexpr int MQ1 = Q1D; \
+        constexpr int MD1 = D1D; \
         constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
         double sDQ[MQ1 * MD1]; \
         double(*Bsmem)[MD1] = (double(*)[MD1])sDQ; \
@@ -214,130 +225,234 @@ Index_type NE = m_NE;
 
 #define MASS3DPA_1 \
   RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz< MPA_D1D; ++dz) { \
+for (int dz = 0; dz< MD1; ++dz) { \
 Xsmem[dz][dy][dx] = X_(dx, dy, dz, e); \
 }
 
 #define MASS3DPA_2 \
   Bsmem[dx][dy] = B_(dx, dy);
 
-// 2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D
+// 2 * MD1 * MD1 * MD1 * MQ1
 #define MASS3DPA_3 \
-  double u[MPA_D1D]; \
+  double u[MD1]; \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; dz++) { \
+for (int dz = 0; dz < MD1; dz++) { \
 u[dz] = 0; \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dx = 0; dx < MPA_D1D; ++dx) { \
+for (int dx = 0; dx < MD1; ++dx) { \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 u[dz] += Xsmem[dz][dy][dx] * Bsmem[qx][dx]; \
 } \
 } \
 RAJAPERF_UNROLL(MD1) \
-for (int dz = 0; dz < MPA_D1D; ++dz) { \
+for (int dz = 0; dz < MD1; ++dz) { \
 DDQ[dz][dy][qx] = u[dz]; \
 }
 
-//2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MD1 * MQ1 * MQ1
 #define MASS3DPA_4 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dy = 0; dy < MPA_D1D; ++dy) { \
+            for (int dy = 0; dy < MD1; ++dy) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; dz++) { \
+              for (int dz = 0; dz < MD1; dz++) { \
                 u[dz] += DDQ[dz][dy][qx] * Bsmem[qy][dy]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; dz++) { \
+            for (int dz = 0; dz < MD1; dz++) { \
               DQQ[dz][qy][qx] = u[dz]; \
             }
 
-//2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D
+//2 * MD1 * MQ1 * MQ1 * MQ1 + MQ1 * MQ1 * MQ1
 #define MASS3DPA_5 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; qz++) { \
+              for (int qz = 0; qz < MQ1; qz++) { \
                 u[qz] += DQQ[dz][qy][qx] * Bsmem[qz][dz]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; qz++) { \
+            for (int qz = 0; qz < MQ1; qz++) { \
               QQQ[qz][qy][qx] = u[qz] * D_(qx, qy, qz, e); \
             }
 
 #define MASS3DPA_6 \
   Btsmem[d][q] = Bt_(q, d);
 
-//2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D
+//2 * MQ1 * MQ1 * MQ1 * MD1
 #define MASS3DPA_7 \
-  double u[MPA_Q1D]; \
+  double u[MQ1]; \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   u[qz] = 0; \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qx = 0; qx < MPA_Q1D; ++qx) { \
+for (int qx = 0; qx < MQ1; ++qx) { \
   RAJAPERF_UNROLL(MQ1) \
-    for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+    for (int qz = 0; qz < MQ1; ++qz) { \
       u[qz] += QQQ[qz][qy][qx] * Btsmem[dx][qx]; \
     } \
  } \
 RAJAPERF_UNROLL(MQ1) \
-for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+for (int qz = 0; qz < MQ1; ++qz) { \
   QQD[qz][qy][dx] = u[qz]; \
  }
 
-// 2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D
+// 2 * MQ1 * MQ1 * MD1 * MD1
 #define MASS3DPA_8 \
-            double u[MPA_Q1D]; \
+            double u[MQ1]; \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               u[qz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qy = 0; qy < MPA_Q1D; ++qy) { \
+            for (int qy = 0; qy < MQ1; ++qy) { \
               RAJAPERF_UNROLL(MQ1) \
-              for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+              for (int qz = 0; qz < MQ1; ++qz) { \
                 u[qz] += QQD[qz][qy][dx] * Btsmem[dy][qy]; \
               } \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               QDD[qz][dy][dx] = u[qz]; \
             }
 
-//2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D
+//2 * MQ1 * MD1 * MD1 * MD1 + MD1 * MD1 * MD1
 #define MASS3DPA_9 \
-            double u[MPA_D1D]; \
+            double u[MD1]; \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               u[dz] = 0; \
             } \
             RAJAPERF_UNROLL(MQ1) \
-            for (int qz = 0; qz < MPA_Q1D; ++qz) { \
+            for (int qz = 0; qz < MQ1; ++qz) { \
               RAJAPERF_UNROLL(MD1) \
-              for (int dz = 0; dz < MPA_D1D; ++dz) { \
+              for (int dz = 0; dz < MD1; ++dz) { \
                 u[dz] += QDD[qz][dy][dx] * Btsmem[dz][qz]; \
               } \
             } \
             RAJAPERF_UNROLL(MD1) \
-            for (int dz = 0; dz < MPA_D1D; ++dz) { \
+            for (int dz = 0; dz < MD1; ++dz) { \
               Y_(dx, dy, dz, e) += u[dz]; \
             }
 
+// Element batched CPU body for the batch of FEM_ELEM_BATCH elements eb,
+// with X, Y and D in element-interleaved order (see interleaveElements).
+// Each stage matches the corresponding MASS3DPA_x stage, with the element
+// lane as the innermost loop.
+#define MASS3DPA_BATCH_BODY \
+  constexpr int MQ1 = Q1D; \
+  constexpr int MD1 = D1D; \
+  constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1; \
+  constexpr int W = FEM_ELEM_BATCH; \
+  double sm0[MDQ * MDQ * MDQ * W]; \
+  double sm1[MDQ * MDQ * MDQ * W]; \
+  const double(*Xb)[MD1][MD1][W] = \
+    (const double(*)[MD1][MD1][W])(X + MD1 * MD1 * MD1 * W * eb); \
+  double(*Yb)[MD1][MD1][W] = \
+    (double(*)[MD1][MD1][W])(Y + MD1 * MD1 * MD1 * W * eb); \
+  const double(*Db)[MQ1][MQ1][W] = \
+    (const double(*)[MQ1][MQ1][W])(D + MQ1 * MQ1 * MQ1 * W * eb); \
+  double(*DDQ)[MD1][MQ1][W] = (double(*)[MD1][MQ1][W])sm1; \
+  double(*DQQ)[MQ1][MQ1][W] = (double(*)[MQ1][MQ1][W])sm0; \
+  double(*QQQ)[MQ1][MQ1][W] = (double(*)[MQ1][MQ1][W])sm1; \
+  double(*QQD)[MQ1][MD1][W] = (double(*)[MQ1][MD1][W])sm0; \
+  double(*QDD)[MD1][MD1][W] = (double(*)[MD1][MD1][W])sm1; \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int dx = 0; dx < MD1; ++dx) { \
+          const double Bqd = B_(qx, dx); \
+          CPU_FOREACH_LANE(l) { u[l] += Xb[dz][dy][dx][l] * Bqd; } \
+        } \
+        CPU_FOREACH_LANE(l) { DDQ[dz][dy][qx][l] = u[l]; } \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int dy = 0; dy < MD1; ++dy) { \
+          const double Bqd = B_(qy, dy); \
+          CPU_FOREACH_LANE(l) { u[l] += DDQ[dz][dy][qx][l] * Bqd; } \
+        } \
+        CPU_FOREACH_LANE(l) { DQQ[dz][qy][qx][l] = u[l]; } \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int qx = 0; qx < MQ1; ++qx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int dz = 0; dz < MD1; ++dz) { \
+          const double Bqd = B_(qz, dz); \
+          CPU_FOREACH_LANE(l) { u[l] += DQQ[dz][qy][qx][l] * Bqd; } \
+        } \
+        CPU_FOREACH_LANE(l) { \
+          QQQ[qz][qy][qx][l] = u[l] * Db[qz][qy][qx][l]; \
+        } \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int qy = 0; qy < MQ1; ++qy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int qx = 0; qx < MQ1; ++qx) { \
+          const double Btdq = Bt_(qx, dx); \
+          CPU_FOREACH_LANE(l) { u[l] += QQQ[qz][qy][qx][l] * Btdq; } \
+        } \
+        CPU_FOREACH_LANE(l) { QQD[qz][qy][dx][l] = u[l]; } \
+      } \
+    } \
+  } \
+  for (int qz = 0; qz < MQ1; ++qz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int qy = 0; qy < MQ1; ++qy) { \
+          const double Btdq = Bt_(qy, dy); \
+          CPU_FOREACH_LANE(l) { u[l] += QQD[qz][qy][dx][l] * Btdq; } \
+        } \
+        CPU_FOREACH_LANE(l) { QDD[qz][dy][dx][l] = u[l]; } \
+      } \
+    } \
+  } \
+  for (int dz = 0; dz < MD1; ++dz) { \
+    for (int dy = 0; dy < MD1; ++dy) { \
+      for (int dx = 0; dx < MD1; ++dx) { \
+        double u[W]; \
+        CPU_FOREACH_LANE(l) { u[l] = 0; } \
+        for (int qz = 0; qz < MQ1; ++qz) { \
+          const double Btdq = Bt_(qz, dz); \
+          CPU_FOREACH_LANE(l) { u[l] += QDD[qz][dy][dx][l] * Btdq; } \
+        } \
+        CPU_FOREACH_LANE(l) { Yb[dz][dy][dx][l] += u[l]; } \
+      } \
+    } \
+  }
+
+
 
 namespace rajaperf
 {
@@ -364,14 +479,29 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int D1D, int Q1D >
+  void runSeqVariantElemBatch(VariantID vid);
+  template < int D1D, int Q1D >
+  void runOpenMPVariantElemBatch(VariantID vid);
 
 private:
+  static std::string getElemBatchTuningName()
+  { return "elem_batch_" + std::to_string(FEM_ELEM_BATCH); }
+  bool isElemBatchTuning(VariantID vid, size_t tune_idx) const
+  { return getVariantTuningName(vid, tune_idx) == getElemBatchTuningName(); }
+
   static const size_t default_gpu_block_size = MPA_Q1D * MPA_Q1D;
   using gpu_block_sizes_type = gpu_block_size::list_type<default_gpu_block_size>;
 
@@ -383,6 +513,9 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
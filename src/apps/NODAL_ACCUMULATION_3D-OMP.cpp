@@ -13,6 +13,7 @@
 #include "AppsData.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -20,7 +21,7 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::runOpenMPVariantAtomic(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -143,5 +144,528 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+void NODAL_ACCUMULATION_3D::runOpenMPVariantColor(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < 8; ++c) {
+          #pragma omp parallel for
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_color_lam = [=](Index_type ii) {
+            NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < 8; ++c) {
+          #pragma omp parallel for
+          for (Index_type ii = color_offsets[c] ; ii < color_offsets[c+1] ; ++ii ) {
+            nodal_accumulation_3d_color_lam(ii);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host()};
+      std::vector<RAJA::TypedListSegment<Index_type>> color_zones;
+      for (Index_type c = 0; c < 8; ++c) {
+        color_zones.emplace_back(colored_zones + color_offsets[c],
+                                 color_offsets[c+1] - color_offsets[c],
+                                 working_res);
+      }
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_BODY;
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < 8; ++c) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            color_zones[c], nodal_accumulation_3d_lam);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantGather(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type k = kmin ; k <= kmax ; ++k ) {
+          for (Index_type j = jmin ; j <= jmax ; ++j ) {
+            for (Index_type i = imin ; i <= imax ; ++i ) {
+              NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+              NODAL_ACCUMULATION_3D_GATHER_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_gather_lam = [=](Index_type i, Index_type j, Index_type k) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type k = kmin ; k <= kmax ; ++k ) {
+          for (Index_type j = jmin ; j <= jmax ; ++j ) {
+            for (Index_type i = imin ; i <= imax ; ++i ) {
+              nodal_accumulation_3d_gather_lam(i, j, k);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                    RAJA::ArgList<2, 1>,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax+1},
+                                                 RAJA::RangeSegment{jmin, jmax+1},
+                                                 RAJA::RangeSegment{kmin, kmax+1}),
+          [=](Index_type i, Index_type j, Index_type k) {
+            NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_GATHER_BODY;
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantBox(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_BOX_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          for (Index_type j = jmin ; j < jmax ; ++j ) {
+            for (Index_type ii = imin ; ii < imax ; ++ii ) {
+              NODAL_ACCUMULATION_3D_BOX_BODY_INDEX;
+
+              Real_type val = 0.125 * vol[i];
+
+              #pragma omp atomic
+              x0[i] += val;
+              #pragma omp atomic
+              x1[i] += val;
+              #pragma omp atomic
+              x2[i] += val;
+              #pragma omp atomic
+              x3[i] += val;
+              #pragma omp atomic
+              x4[i] += val;
+              #pragma omp atomic
+              x5[i] += val;
+              #pragma omp atomic
+              x6[i] += val;
+              #pragma omp atomic
+              x7[i] += val;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_box_lam = [=](Index_type ii, Index_type j, Index_type k) {
+            NODAL_ACCUMULATION_3D_BOX_BODY_INDEX;
+
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type k = kmin ; k < kmax ; ++k ) {
+          for (Index_type j = jmin ; j < jmax ; ++j ) {
+            for (Index_type ii = imin ; ii < imax ; ++ii ) {
+              nodal_accumulation_3d_box_lam(ii, j, k);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                    RAJA::ArgList<2, 1>,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax},
+                                                 RAJA::RangeSegment{jmin, jmax},
+                                                 RAJA::RangeSegment{kmin, kmax}),
+          [=](Index_type ii, Index_type j, Index_type k) {
+            NODAL_ACCUMULATION_3D_BOX_BODY_INDEX;
+            NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariantIndexSet(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NODAL_ACCUMULATION_3D_INDEX_SET_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type r = 0 ; r < nrows ; ++r ) {
+          for (Index_type i = row_begins[r] ; i < row_begins[r] + row_len ; ++i ) {
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type r = 0 ; r < nrows ; ++r ) {
+          for (Index_type i = row_begins[r] ; i < row_begins[r] + row_len ; ++i ) {
+            nodal_accumulation_3d_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      RAJA::TypedIndexSet<RAJA::RangeSegment> zones;
+      for (Index_type r = 0 ; r < nrows ; ++r ) {
+        zones.push_back( RAJA::RangeSegment(row_begins[r], row_begins[r] + row_len) );
+      }
+
+      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+                                         NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+                                       };
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::loop_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(zones, nodal_accumulation_3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NODAL_ACCUMULATION_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantAtomic(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantColor(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantGather(vid);
+
+  }
+
+  t += 1;
+
+  for (size_t iorder = 0; iorder < 3; ++iorder) {
+
+    if (tune_idx == t) {
+
+      // morton, hilbert, and random zone orders, see setUp
+      runOpenMPVariantAtomic(vid);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantBox(vid);
+
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantIndexSet(vid);
+
+  }
+
+  t += 1;
+}
+
+void NODAL_ACCUMULATION_3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "default");
+
+  addVariantTuningName(vid, "color_8");
+
+  addVariantTuningName(vid, "node_gather");
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::morton));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::hilbert));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::random));
+
+  addVariantTuningName(vid, "box");
+
+  addVariantTuningName(vid, "index_set");
+}
+
 } // end namespace apps
 } // end namespace rajaperf
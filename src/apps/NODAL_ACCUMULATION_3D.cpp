@@ -29,11 +29,18 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
   setDefaultReps(100);
 
   Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
-  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+  m_domain = new ADomain(rzmax, /* ndims = */ 3, params);
 
   m_nodal_array_length = m_domain->nnalls;
   m_zonal_array_length = m_domain->lpz+1;
 
+  m_colored_zones.resize(m_domain->n_real_zones);
+  m_color_offsets.resize(9);
+  setColoredZones_3d(m_colored_zones.data(), m_color_offsets.data(), *m_domain);
+
+  m_row_begins.resize((m_domain->jmax - m_domain->jmin)*(m_domain->kmax - m_domain->kmin));
+  setRealZoneRows(m_row_begins.data(), *m_domain);
+
   setActualProblemSize( m_domain->n_real_zones );
 
   setItsPerRep( getActualProblemSize() );
@@ -42,6 +49,14 @@ NODAL_ACCUMULATION_3D::NODAL_ACCUMULATION_3D(const RunParams& params)
   setBytesPerRep( (0*sizeof(Index_type) + 1*sizeof(Index_type)) * getItsPerRep() +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_domain->imax+1 - m_domain->imin)*(m_domain->jmax+1 - m_domain->jmin)*(m_domain->kmax+1 - m_domain->kmin));
+  // box and index_set tunings read no zone list, index_set reads one index per row
+  setTuningBytesPerRep( "box",
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_domain->imax+1 - m_domain->imin)*(m_domain->jmax+1 - m_domain->jmin)*(m_domain->kmax+1 - m_domain->kmin));
+  setTuningBytesPerRep( "index_set",
+                  (0*sizeof(Index_type) + 1*sizeof(Index_type)) * m_row_begins.size() +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * (m_domain->imax+1 - m_domain->imin)*(m_domain->jmax+1 - m_domain->jmin)*(m_domain->kmax+1 - m_domain->kmin));
   setFLOPsPerRep(9 * getItsPerRep());
 
   checksum_scale_factor = 0.001 *
@@ -74,10 +89,16 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
+  setZoneOrder(m_domain->real_zones, m_domain->n_real_zones,
+               getZoneOrder(getVariantTuningName(vid, tune_idx)), *m_domain);
+
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
-  allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
+  allocAndInitDataConst(m_vol, m_zonal_array_length, 0.0, vid);
+  for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+    m_vol[m_domain->real_zones[ii]] = 1.0;
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
@@ -27,21 +27,108 @@
 ///
 /// }
 ///
+/// The default tunings perform the eight nodal updates of each zone
+/// atomically in the OpenMP variants. The color_8 tunings partition the
+/// zones into 8 colors by the parity of their i, j, k indices; zones of
+/// one color share no nodes, so each color runs without atomics.
+/// The node_gather tunings invert the loop and accumulate into each node
+/// of the structured box from its (up to) 8 adjacent zones:
+///
+/// for (Index_type k = kmin; k <= kmax; ++k ) {
+///   for (Index_type j = jmin; j <= jmax; ++j ) {
+///     for (Index_type i = imin; i <= imax; ++i ) {
+///       Index_type in = i + j*jp + k*kp;
+///       x[in] += 0.125 * ( vol[in]         + vol[in-1] +
+///                          vol[in-jp]      + vol[in-1-jp] +
+///                          vol[in-kp]      + vol[in-1-kp] +
+///                          vol[in-jp-kp]   + vol[in-1-jp-kp] );
+///     }
+///   }
+/// }
+///
+/// Zones outside the real zones have zero volume, so the gather needs no
+/// test for them.
+///
+/// The "morton", "hilbert", and "random" CPU tunings run the atomic
+/// version with real_zones sorted in that order (see setZoneOrder in
+/// AppsData.hpp). The mesh data layout is unchanged.
+///
+/// The "box" CPU tunings run the atomic version over the (i,j,k) box of
+/// real zones directly and the "index_set" tunings over one range segment
+/// per row of real zones (a RAJA index set in the RAJA variants); neither
+/// reads real_zones.
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 
-#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+#define NODAL_ACCUMULATION_3D_MESH_DATA_SETUP \
   Real_ptr x = m_x; \
   Real_ptr vol = m_vol; \
   \
-  Real_ptr x0,x1,x2,x3,x4,x5,x6,x7; \
+  Real_ptr x0,x1,x2,x3,x4,x5,x6,x7;
+
+#define NODAL_ACCUMULATION_3D_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_MESH_DATA_SETUP \
   \
   Index_ptr real_zones = m_domain->real_zones;
 
 #define NODAL_ACCUMULATION_3D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
+#define NODAL_ACCUMULATION_3D_BOX_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_MESH_DATA_SETUP \
+  \
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+  const Index_type kmin = m_domain->kmin; \
+  const Index_type kmax = m_domain->kmax; \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define NODAL_ACCUMULATION_3D_BOX_BODY_INDEX \
+  Index_type i = ii + j*jp + k*kp;
+
+#define NODAL_ACCUMULATION_3D_INDEX_SET_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_MESH_DATA_SETUP \
+  \
+  Index_ptr row_begins = m_row_begins.data(); \
+  const Index_type nrows = m_row_begins.size(); \
+  const Index_type row_len = m_domain->imax - m_domain->imin;
+
+#define NODAL_ACCUMULATION_3D_COLOR_DATA_SETUP \
+  NODAL_ACCUMULATION_3D_MESH_DATA_SETUP \
+  \
+  Index_ptr colored_zones = m_colored_zones.data(); \
+  const Index_ptr color_offsets = m_color_offsets.data();
+
+#define NODAL_ACCUMULATION_3D_COLOR_BODY_INDEX \
+  Index_type i = colored_zones[ii];
+
+#define NODAL_ACCUMULATION_3D_GATHER_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+  const Index_type kmin = m_domain->kmin; \
+  const Index_type kmax = m_domain->kmax; \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp;
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY_INDEX \
+  Index_type in = i + j*jp + k*kp;
+
+#define NODAL_ACCUMULATION_3D_GATHER_BODY \
+  x[in] += 0.125 * ( vol[in]       + vol[in-1] + \
+                     vol[in-jp]    + vol[in-1-jp] + \
+                     vol[in-kp]    + vol[in-1-kp] + \
+                     vol[in-jp-kp] + vol[in-1-jp-kp] );
+
 #define NODAL_ACCUMULATION_3D_BODY \
   Real_type val = 0.125 * vol[i]; \
   \
@@ -70,6 +157,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -96,8 +185,20 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantAtomic(VariantID vid);
+  void runSeqVariantColor(VariantID vid);
+  void runSeqVariantGather(VariantID vid);
+  void runSeqVariantBox(VariantID vid);
+  void runSeqVariantIndexSet(VariantID vid);
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantColor(VariantID vid);
+  void runOpenMPVariantGather(VariantID vid);
+  void runOpenMPVariantBox(VariantID vid);
+  void runOpenMPVariantIndexSet(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -111,6 +212,9 @@ private:
   Real_ptr m_vol;
 
   ADomain* m_domain;
+  std::vector<Index_type> m_colored_zones;
+  std::vector<Index_type> m_color_offsets;
+  std::vector<Index_type> m_row_begins;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
 };
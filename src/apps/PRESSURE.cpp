@@ -29,7 +29,10 @@ PRESSURE::PRESSURE(const RunParams& params)
   setItsPerRep( 2 * getActualProblemSize() );
   setKernelsPerRep(2);
   setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() +
-                  (1*sizeof(Real_type) + 2*sizeof(Real_type)) * getActualProblemSize() );
+                  (1*sizeof(Real_type) + 3*sizeof(Real_type)) * getActualProblemSize() );
+  // fused tuning does not read back bvc
+  setTuningBytesPerRep( "fused",
+                        (2*sizeof(Real_type) + 3*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep((2 +
                   1
                   ) * getActualProblemSize());
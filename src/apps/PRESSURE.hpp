@@ -20,6 +20,9 @@
 ///   if ( p_new[i]  <  pmin ) p_new[i]   = pmin ;
 /// }
 ///
+/// The "fused" CPU tunings execute both loop bodies in a single loop over zones,
+/// so each zone array is streamed once per rep instead of once per loop.
+///
 
 #ifndef RAJAPerf_Apps_PRESSURE_HPP
 #define RAJAPerf_Apps_PRESSURE_HPP
@@ -45,6 +48,15 @@
   if ( vnewc[i] >= eosvmax ) p_new[i] = 0.0 ; \
   if ( p_new[i]  <  pmin ) p_new[i]   = pmin ;
 
+//
+// Fused tunings run all bodies in a single pass over the zones. Each body
+// reads only zone i values written by the bodies before it, so the
+// results match the unfused loops exactly.
+//
+#define PRESSURE_FUSED_BODY \
+  { PRESSURE_BODY1 } \
+  { PRESSURE_BODY2 }
+
 
 #include "common/KernelBase.hpp"
 
@@ -73,8 +85,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -0,0 +1,329 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+SPMV::SPMV(const RunParams& params)
+  : KernelBase(rajaperf::Apps_SPMV, params)
+{
+  setDefaultProblemSize(100*100*100);  // See rzmax in ADomain struct
+  setDefaultReps(50);
+
+  Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
+  m_domain = new ADomain(rzmax, /* ndims = */ 3, params);
+
+  m_matrix = run_params.getSpmvMatrix();
+
+  m_nrows = m_domain->n_real_zones;
+
+  std::vector<Int_type> row_ptr;
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+  setCSRMatrix(row_ptr, col, val);
+  m_nnz = col.size();
+
+  setActualProblemSize( m_nrows );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // touched data size of the csr format
+  setBytesPerRep( (1*sizeof(Int_type) + 0*sizeof(Int_type)) * (m_nrows+1) +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * m_nnz +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nnz +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows );
+
+  //
+  // The ell and sell formats have no row pointers and read their padding
+  // entries along with the matrix entries.
+  //
+  m_ell_width = 0;
+  for (Index_type r = 0; r < m_nrows; ++r) {
+    m_ell_width = std::max(m_ell_width, Index_type(row_ptr[r+1] - row_ptr[r]));
+  }
+  setTuningBytesPerRep( "ell",
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * m_nrows*m_ell_width +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows*m_ell_width +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows );
+
+  std::vector<Int_type> sell_perm;
+  std::vector<Int_type> sell_slice_ptr;
+  setSELLSlices(row_ptr, sell_perm, sell_slice_ptr);
+  const Index_type sell_nnz = sell_slice_ptr.back();
+  setTuningBytesPerRep( getSELLTuningName(),
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * sell_slice_ptr.size() +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * m_nrows +
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * sell_nnz +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * sell_nnz +
+                  (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows );
+  setFLOPsPerRep(2 * m_nnz);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV::~SPMV()
+{
+  delete m_domain;
+}
+
+std::string SPMV::getSELLTuningName()
+{
+  return "sell_" + std::to_string(s_sell_chunk_size) +
+         "_" + std::to_string(s_sell_sort_scope);
+}
+
+void SPMV::addFormatTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, "csr");
+  addVariantTuningName(vid, "ell");
+  addVariantTuningName(vid, getSELLTuningName());
+}
+
+//
+// Build the matrix in csr format with rows ordered like the domain
+// real zones and sorted column indices in each row.
+//
+void SPMV::setCSRMatrix(std::vector<Int_type>& row_ptr,
+                        std::vector<Int_type>& col,
+                        std::vector<Real_type>& val) const
+{
+  row_ptr.assign(1, 0);
+  col.clear();
+  val.clear();
+
+  if (m_matrix == "random") {
+
+    std::mt19937 gen(4793);
+
+    for (Index_type r = 0; r < m_nrows; ++r) {
+      Index_type len = 1 + static_cast<Index_type>(gen() % 27);
+      Index_type row_begin = col.size();
+      col.push_back(r);
+      for (Index_type j = 1; j < len; ++j) {
+        col.push_back(static_cast<Int_type>(gen() % m_nrows));
+      }
+      std::sort(col.begin() + row_begin, col.end());
+      for (Index_type k = row_begin; k < Index_type(col.size()); ++k) {
+        val.push_back( (col[k] == r) ? Real_type(len) : -1.0 );
+      }
+      row_ptr.push_back(col.size());
+    }
+
+  } else {
+
+    const bool full = (m_matrix == "stencil_27");
+
+    const Index_type ni = m_domain->imax - m_domain->imin;
+    const Index_type nj = m_domain->jmax - m_domain->jmin;
+    const Index_type nk = m_domain->kmax - m_domain->kmin;
+
+    for (Index_type k = 0; k < nk; ++k) {
+      for (Index_type j = 0; j < nj; ++j) {
+        for (Index_type i = 0; i < ni; ++i) {
+          Index_type r = i + ni * (j + nj * k);
+          Index_type row_begin = col.size();
+          for (Index_type dk = -1; dk <= 1; ++dk) {
+            for (Index_type dj = -1; dj <= 1; ++dj) {
+              for (Index_type di = -1; di <= 1; ++di) {
+                if ( !full && std::abs(di) + std::abs(dj) + std::abs(dk) > 1 ) {
+                  continue;
+                }
+                if ( i+di < 0 || i+di >= ni ||
+                     j+dj < 0 || j+dj >= nj ||
+                     k+dk < 0 || k+dk >= nk ) {
+                  continue;
+                }
+                col.push_back( (i+di) + ni * ((j+dj) + nj * (k+dk)) );
+              }
+            }
+          }
+          Index_type len = col.size() - row_begin;
+          for (Index_type kk = row_begin; kk < Index_type(col.size()); ++kk) {
+            val.push_back( (col[kk] == r) ? Real_type(len) : -1.0 );
+          }
+          row_ptr.push_back(col.size());
+        }
+      }
+    }
+
+  }
+}
+
+//
+// Order rows by decreasing length within windows of the sort scope and
+// group them into slices of the chunk size, each padded to its longest
+// row; slice_ptr holds the offset of each slice including padding.
+//
+void SPMV::setSELLSlices(const std::vector<Int_type>& row_ptr,
+                         std::vector<Int_type>& perm,
+                         std::vector<Int_type>& slice_ptr) const
+{
+  const Index_type C = s_sell_chunk_size;
+  const Index_type nslices = (m_nrows + C - 1) / C;
+
+  auto row_len = [&](Index_type r) { return row_ptr[r+1] - row_ptr[r]; };
+
+  perm.resize(m_nrows);
+  for (Index_type r = 0; r < m_nrows; ++r) {
+    perm[r] = r;
+  }
+  for (Index_type begin = 0; begin < m_nrows; begin += s_sell_sort_scope) {
+    Index_type end = std::min(begin + s_sell_sort_scope, m_nrows);
+    std::stable_sort(perm.begin() + begin, perm.begin() + end,
+                     [&](Int_type a, Int_type b) {
+                       return row_len(a) > row_len(b);
+                     });
+  }
+
+  slice_ptr.assign(nslices+1, 0);
+  for (Index_type s = 0; s < nslices; ++s) {
+    Index_type width = 0;
+    for (Index_type p = s*C; p < std::min((s+1)*C, m_nrows); ++p) {
+      width = std::max(width, Index_type(row_len(perm[p])));
+    }
+    slice_ptr[s+1] = slice_ptr[s] + width * C;
+  }
+}
+
+void SPMV::setUp(VariantID vid, size_t tune_idx)
+{
+  allocAndInitData(m_x, m_nrows, vid);
+  allocAndInitDataConst(m_y, m_nrows, 0.0, vid);
+
+  m_row_ptr = nullptr;
+  m_col = nullptr;
+  m_val = nullptr;
+  m_sell_slice_ptr = nullptr;
+  m_sell_perm = nullptr;
+
+  std::vector<Int_type> row_ptr;
+  std::vector<Int_type> col;
+  std::vector<Real_type> val;
+  setCSRMatrix(row_ptr, col, val);
+
+  auto row_len = [&](Index_type r) { return row_ptr[r+1] - row_ptr[r]; };
+
+  if (tune_idx == 0) {
+
+    allocData(m_row_ptr, m_nrows+1);
+    allocData(m_col, m_nnz);
+    allocData(m_val, m_nnz);
+    std::copy(row_ptr.begin(), row_ptr.end(), m_row_ptr);
+    std::copy(col.begin(), col.end(), m_col);
+    std::copy(val.begin(), val.end(), m_val);
+
+  } else if (tune_idx == 1) {
+
+    //
+    // Padding entries multiply zero by the row's own x entry.
+    //
+    allocData(m_col, m_nrows*m_ell_width);
+    allocData(m_val, m_nrows*m_ell_width);
+    for (Index_type r = 0; r < m_nrows; ++r) {
+      for (Index_type j = 0; j < m_ell_width; ++j) {
+        Index_type k = j * m_nrows + r;
+        if (j < row_len(r)) {
+          m_col[k] = col[row_ptr[r] + j];
+          m_val[k] = val[row_ptr[r] + j];
+        } else {
+          m_col[k] = r;
+          m_val[k] = 0.0;
+        }
+      }
+    }
+
+  } else {
+
+    const Index_type C = s_sell_chunk_size;
+    const Index_type nslices = (m_nrows + C - 1) / C;
+
+    std::vector<Int_type> sell_perm;
+    std::vector<Int_type> sell_slice_ptr;
+    setSELLSlices(row_ptr, sell_perm, sell_slice_ptr);
+
+    allocData(m_sell_perm, m_nrows);
+    allocData(m_sell_slice_ptr, nslices+1);
+    std::copy(sell_perm.begin(), sell_perm.end(), m_sell_perm);
+    std::copy(sell_slice_ptr.begin(), sell_slice_ptr.end(), m_sell_slice_ptr);
+
+    //
+    // Padding entries, including lanes past the last row, multiply zero
+    // by x[0].
+    //
+    allocData(m_col, m_sell_slice_ptr[nslices]);
+    allocData(m_val, m_sell_slice_ptr[nslices]);
+    for (Index_type s = 0; s < nslices; ++s) {
+      Index_type width = (m_sell_slice_ptr[s+1] - m_sell_slice_ptr[s]) / C;
+      for (Index_type lane = 0; lane < C; ++lane) {
+        Index_type p = s*C + lane;
+        for (Index_type j = 0; j < width; ++j) {
+          Index_type k = m_sell_slice_ptr[s] + j * C + lane;
+          if (p < m_nrows && j < row_len(m_sell_perm[p])) {
+            m_col[k] = col[row_ptr[m_sell_perm[p]] + j];
+            m_val[k] = val[row_ptr[m_sell_perm[p]] + j];
+          } else {
+            m_col[k] = 0;
+            m_val[k] = 0.0;
+          }
+        }
+      }
+    }
+
+  }
+}
+
+void SPMV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, m_nrows, checksum_scale_factor );
+}
+
+void SPMV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_row_ptr);
+  deallocData(m_col);
+  deallocData(m_val);
+  deallocData(m_sell_slice_ptr);
+  deallocData(m_sell_perm);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV kernel reference implementation (CSR format):
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) {
+///     dot += val[k] * x[col[k]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// Matrix rows are the real zones of a 3d ADomain. The matrix is chosen with
+/// the --spmv_matrix command line option: the 7-point or 27-point stencil
+/// coupling each zone to its neighbors, or a random sparsity pattern with
+/// 1 to 27 entries per row and columns spread over the whole domain.
+///
+/// The storage format is a tuning of the kernel:
+///   csr    - compressed sparse rows as above.
+///   ell    - ELLPACK; every row padded to the longest row length and
+///            stored column-major so consecutive rows are contiguous.
+///   sell   - SELL-C-sigma; rows sorted by length within windows of sigma
+///            rows, then grouped into slices of C rows each padded to the
+///            longest row length in the slice and stored column-major.
+///
+
+#ifndef RAJAPerf_Apps_SPMV_HPP
+#define RAJAPerf_Apps_SPMV_HPP
+
+#define SPMV_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_CSR_DATA_SETUP \
+  SPMV_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr;
+
+#define SPMV_ELL_DATA_SETUP \
+  SPMV_DATA_SETUP \
+  const Index_type nrows = m_nrows; \
+  const Index_type ell_width = m_ell_width;
+
+#define SPMV_SELL_DATA_SETUP \
+  SPMV_DATA_SETUP \
+  Int_ptr sell_slice_ptr = m_sell_slice_ptr; \
+  Int_ptr sell_perm = m_sell_perm; \
+  const Index_type sell_chunk = s_sell_chunk_size;
+
+#define SPMV_CSR_BODY  \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_ELL_BODY  \
+  Real_type dot = 0.0; \
+  for (Index_type j = 0; j < ell_width; ++j ) { \
+    Index_type k = j * nrows + i; \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_SELL_BODY  \
+  Real_type dot = 0.0; \
+  Index_type slice = i / sell_chunk; \
+  for (Index_type k = sell_slice_ptr[slice] + i % sell_chunk; \
+       k < sell_slice_ptr[slice+1]; k += sell_chunk ) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[sell_perm[i]] = dot;
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class SPMV : public KernelBase
+{
+public:
+
+  SPMV(const RunParams& params);
+
+  ~SPMV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantCSR(VariantID vid);
+  void runSeqVariantELL(VariantID vid);
+  void runSeqVariantSELL(VariantID vid);
+  void runOpenMPVariantCSR(VariantID vid);
+  void runOpenMPVariantELL(VariantID vid);
+  void runOpenMPVariantSELL(VariantID vid);
+
+private:
+  static const Index_type s_sell_chunk_size = 8;
+  static const Index_type s_sell_sort_scope = 256;
+
+  static std::string getSELLTuningName();
+
+  void addFormatTuningNames(VariantID vid);
+  void setCSRMatrix(std::vector<Int_type>& row_ptr,
+                    std::vector<Int_type>& col,
+                    std::vector<Real_type>& val) const;
+  void setSELLSlices(const std::vector<Int_type>& row_ptr,
+                     std::vector<Int_type>& perm,
+                     std::vector<Int_type>& slice_ptr) const;
+
+  ADomain* m_domain;
+  std::string m_matrix;
+
+  Index_type m_nrows;
+  Index_type m_nnz;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Index_type m_ell_width;
+
+  Int_ptr m_sell_slice_ptr;
+  Int_ptr m_sell_perm;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -12,6 +12,8 @@
 
 #include "AppsData.hpp"
 
+#include "camp/resource.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -20,7 +22,7 @@ namespace apps
 {
 
 
-void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -97,5 +99,116 @@ void VOL3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 #endif
 }
 
+void VOL3D::runOpenMPVariantZoneList(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_zones.size();
+
+  VOL3D_DATA_SETUP;
+  VOL3D_ZONE_LIST_DATA_SETUP;
+
+  NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
+  NDPTRSET(m_domain->jp, m_domain->kp, y,y0,y1,y2,y3,y4,y5,y6,y7) ;
+  NDPTRSET(m_domain->jp, m_domain->kp, z,z0,z1,z2,z3,z4,z5,z6,z7) ;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          VOL3D_ZONE_LIST_BODY_INDEX;
+          VOL3D_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto vol3d_base_lam = [=](Index_type ii) {
+                              VOL3D_ZONE_LIST_BODY_INDEX;
+                              VOL3D_BODY;
+                            };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+          vol3d_base_lam(ii);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      camp::resources::Resource working_res{camp::resources::Host::get_default()};
+      RAJA::TypedListSegment<Index_type> zone_list(zones, iend, working_res);
+
+      auto vol3d_lam = [=](Index_type i) {
+                         VOL3D_BODY;
+                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(zone_list, vol3d_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  VOL3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void VOL3D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if ( getZoneOrder(getVariantTuningName(vid, tune_idx)) ==
+       ZoneOrder::lexicographic ) {
+
+    runOpenMPVariantDefault(vid);
+
+  } else {
+
+    runOpenMPVariantZoneList(vid);
+
+  }
+}
+
+void VOL3D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::morton));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::hilbert));
+
+  addVariantTuningName(vid, getZoneOrderName(ZoneOrder::random));
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -29,7 +29,7 @@ VOL3D::VOL3D(const RunParams& params)
   setDefaultReps(100);
 
   Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
-  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+  m_domain = new ADomain(rzmax, /* ndims = */ 3, params);
 
   m_array_length = m_domain->nnalls;
 
@@ -71,8 +71,17 @@ VOL3D::~VOL3D()
   delete m_domain;
 }
 
-void VOL3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void VOL3D::setUp(VariantID vid, size_t tune_idx)
 {
+  ZoneOrder order = getZoneOrder(getVariantTuningName(vid, tune_idx));
+  if ( order != ZoneOrder::lexicographic ) {
+    m_zones.resize(m_domain->lpz+1 - m_domain->fpz);
+    for (Index_type ii = 0; ii < Index_type(m_zones.size()); ++ii) {
+      m_zones[ii] = m_domain->fpz + ii;
+    }
+    setZoneOrder(m_zones.data(), m_zones.size(), order, *m_domain);
+  }
+
   allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_y, m_array_length, 0.0, vid);
   allocAndInitDataConst(m_z, m_array_length, 0.0, vid);
@@ -100,6 +109,8 @@ void VOL3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_y);
   deallocData(m_z);
   deallocData(m_vol);
+
+  m_zones.clear();
 }
 
 } // end namespace apps
@@ -65,6 +65,10 @@
 ///   vol[i] *= vnormq ;
 /// }
 ///
+/// The "morton", "hilbert", and "random" CPU tunings traverse the zones
+/// through a list sorted in that order (see setZoneOrder in AppsData.hpp).
+/// The mesh data layout is unchanged.
+///
 
 #ifndef RAJAPerf_Apps_VOL3D_HPP
 #define RAJAPerf_Apps_VOL3D_HPP
@@ -141,9 +145,17 @@
  \
   vol[i] *= vnormq ;
 
+#define VOL3D_ZONE_LIST_DATA_SETUP \
+  Index_ptr zones = m_zones.data();
+
+#define VOL3D_ZONE_LIST_BODY_INDEX \
+  Index_type i = zones[ii];
+
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -170,8 +182,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantZoneList(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantZoneList(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -189,6 +207,7 @@ private:
   Real_type m_vnormq;
 
   ADomain* m_domain;
+  std::vector<Index_type> m_zones;
   Index_type m_array_length;
 };
 
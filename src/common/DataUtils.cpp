@@ -11,7 +11,11 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 namespace rajaperf
 {
@@ -399,4 +403,62 @@ long double calcChecksum(const Complex_ptr ptr, int len,
   return tchk;
 }
 
+/*
+ * Copy multi-plane data between planar and blocked layouts.
+ */
+void copyPlanarToBlocked(Real_ptr blocked, Real_ptr planar,
+                         int len, int nplanes, int block_size)
+{
+  for (Index_type k = 0; k < nplanes; ++k) {
+    for (Index_type i = 0; i < len; ++i) {
+      blocked[getBlockedIndex(i, k, nplanes, block_size)] = planar[i + len*k];
+    }
+  }
+}
+
+void copyBlockedToPlanar(Real_ptr planar, Real_ptr blocked,
+                         int len, int nplanes, int block_size)
+{
+  for (Index_type k = 0; k < nplanes; ++k) {
+    for (Index_type i = 0; i < len; ++i) {
+      planar[i + len*k] = blocked[getBlockedIndex(i, k, nplanes, block_size)];
+    }
+  }
+}
+
+/*
+ * Calculate max error in ULPs of data arrays against reference values.
+ */
+long double calcMaxUlpError(const Real_ptr ptr, const Real_ptr ref, int len)
+{
+#if defined(RP_USE_DOUBLE)
+  using Bits_type = std::int64_t;
+#else
+  using Bits_type = std::int32_t;
+#endif
+  static_assert(sizeof(Bits_type) == sizeof(Real_type),
+                "ULP error requires an integer type the size of Real_type");
+
+  // map the bits of a value to an integer that is ordered like the values
+  auto ordered_bits = [](Real_type val) {
+    Bits_type bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return (bits < 0) ? std::numeric_limits<Bits_type>::min() - bits : bits;
+  };
+
+  long double max_ulps = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    if (std::isnan(ptr[j]) || std::isnan(ref[j])) {
+      if (!(std::isnan(ptr[j]) && std::isnan(ref[j]))) {
+        max_ulps = std::numeric_limits<long double>::infinity();
+      }
+      continue;
+    }
+    long double ulps = std::abs(static_cast<long double>(ordered_bits(ptr[j])) -
+                                static_cast<long double>(ordered_bits(ref[j])));
+    max_ulps = std::max(max_ulps, ulps);
+  }
+  return max_ulps;
+}
+
 }  // closing brace for rajaperf namespace
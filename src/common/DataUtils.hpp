@@ -190,6 +190,48 @@ long double calcChecksum(Real_ptr d, int len,
 long double calcChecksum(Complex_ptr d, int len,
                          Real_type scale_factor = 1.0);
 
+/*!
+ * \brief Index of entry i of plane k of multi-plane data stored in blocks
+ *        of block_size entries, each block holding its entries of every
+ *        plane contiguously, plane by plane (blocked SoA).
+ *
+ * A block size of 1 gives the interleaved (AoS) layout.
+ */
+inline Index_type getBlockedIndex(Index_type i, Index_type k,
+                                  Index_type nplanes, Index_type block_size)
+{
+  return (i / block_size) * block_size * nplanes +
+         k * block_size + i % block_size;
+}
+
+/*!
+ * \brief Length of a blocked array holding nplanes planes of len entries,
+ *        padded to a whole number of blocks.
+ */
+inline Index_type getBlockedLength(Index_type len, Index_type nplanes,
+                                   Index_type block_size)
+{
+  return (len + block_size - 1) / block_size * block_size * nplanes;
+}
+
+/*!
+ * \brief Copy multi-plane data between the planar layout, with entry i of
+ *        plane k at i + len*k, and the blocked layout of getBlockedIndex.
+ */
+void copyPlanarToBlocked(Real_ptr blocked, Real_ptr planar,
+                         int len, int nplanes, int block_size);
+///
+void copyBlockedToPlanar(Real_ptr planar, Real_ptr blocked,
+                         int len, int nplanes, int block_size);
+
+/*!
+ * \brief Calculate and return the max error, in units in the last place
+ *        (ULPs), of data array entries relative to reference values.
+ *
+ * Entries that are NaN in only one of the arrays have infinite error.
+ */
+long double calcMaxUlpError(Real_ptr d, Real_ptr ref, int len);
+
 
 /*!
  * \brief Holds a RajaPool object and provides access to it via a
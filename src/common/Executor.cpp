@@ -594,11 +594,7 @@ void Executor::setupSuite()
 
     for (KIDset::iterator kid = run_kern.begin();
          kid != run_kern.end(); ++kid) {
-///   RDH DISABLE COUPLE KERNEL until we find a reasonable way to do
-///   complex numbers in GPU code
-      if ( *kid != Apps_COUPLE ) {
-        kernels.push_back( getKernelObject(*kid, run_params) );
-      }
+      kernels.push_back( getKernelObject(*kid, run_params) );
     }
 
     if ( !(run_params.getInvalidVariantInput().empty()) ||
@@ -953,6 +949,12 @@ void Executor::outputRunData()
       file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
       writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
     }
+
+    file = openOutputFile(out_fprefix + "-bandwidth-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Bandwidth, combiner, 3 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-flops-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::FLOPRate, combiner, 3 /* prec */);
   }
 
   file = openOutputFile(out_fprefix + "-checksum.txt");
@@ -1070,7 +1072,9 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
                (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
                 !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
             file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
+          } else if ( (mode == CSVRepMode::Timing ||
+                       mode == CSVRepMode::Bandwidth ||
+                       mode == CSVRepMode::FLOPRate) &&
                       !kern->hasVariantTuningDefined(vid, tuning_name) ) {
             file << "Not run";
           } else {
@@ -1481,6 +1485,22 @@ void Executor::writeChecksumReport(ostream& file)
         }
       }
 
+      // get vector of max ULP errors, for kernels that check them
+      std::vector<std::vector<Checksum_type>> ulp_errors(variant_ids.size());
+      if ( kern->checksUlpError() ) {
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          VariantID vid = variant_ids[iv];
+          size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+
+          ulp_errors[iv].resize(num_tunings, 0.0);
+          for (size_t tune_idx = 0; tune_idx < num_tunings; ++tune_idx) {
+            if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+              ulp_errors[iv][tune_idx] = kern->getMaxUlpError(vid, tune_idx);
+            }
+          }
+        }
+      }
+
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
 
       // get stats for checksums
@@ -1558,6 +1578,17 @@ void Executor::writeChecksumReport(ostream& file)
         }
       }
 
+      // get max ULP errors over ranks
+      if ( kern->checksUlpError() ) {
+        for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+          size_t num_tunings = kernels[ik]->getNumVariantTunings(variant_ids[iv]);
+          std::vector<Checksum_type> ulp_errors_max(num_tunings, 0.0);
+          Allreduce(ulp_errors[iv].data(), ulp_errors_max.data(), num_tunings,
+                    MPI_MAX, MPI_COMM_WORLD);
+          ulp_errors[iv] = ulp_errors_max;
+        }
+      }
+
 #endif
 
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
@@ -1574,11 +1605,20 @@ void Executor::writeChecksumReport(ostream& file)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
                  <<left<< setw(checksum_width) << checksums_avg[iv][tune_idx]
                  <<left<< setw(checksum_width) << checksums_abs_diff_max[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx] << endl;
+                 <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv][tune_idx];
 #else
                  <<left<< setw(checksum_width) << checksums[iv][tune_idx]
-                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx] << endl;
+                 <<left<< setw(checksum_width) << checksums_diff[iv][tune_idx];
 #endif
+            if ( kern->checksUlpError() ) {
+              file << noshowpoint << setprecision(6)
+                   << "Max ULP error = " << ulp_errors[iv][tune_idx];
+              if ( ulp_errors[iv][tune_idx] > kern->getUlpTolerance(vid, tune_idx) ) {
+                file << "  OVER_TOL (tolerance = "
+                     << kern->getUlpTolerance(vid, tune_idx) << ")";
+              }
+            }
+            file << endl;
           } else {
             file <<left<< setw(namecol_width) << (variant_name+"-"+tuning_name)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
@@ -1635,6 +1675,14 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       }
       break;
     }
+    case CSVRepMode::Bandwidth : {
+      title += string("Bandwidth Report (GB/s) ");
+      break;
+    }
+    case CSVRepMode::FLOPRate : {
+      title += string("FLOP Rate Report (GFLOP/s) ");
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return title;
@@ -1702,6 +1750,35 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::Bandwidth : {
+      //
+      // Bytes moved per rep may depend on the tuning (e.g., fused loops),
+      // so use the tuning-specific value when a kernel provides one.
+      //
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      long double bytes = static_cast<long double>(
+                            kern->getBytesPerRep(vid, tune_idx)) *
+                          kern->getRunReps();
+      if ( time > 0.0 && bytes > 0.0 ) {
+        retval = bytes / time / 1.0e9;
+      } else {
+        retval = 0.0;
+      }
+      break;
+    }
+    case CSVRepMode::FLOPRate : {
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      long double flops = static_cast<long double>(kern->getFLOPsPerRep()) *
+                          kern->getRunReps();
+      if ( time > 0.0 && flops > 0.0 ) {
+        retval = flops / time / 1.0e9;
+      } else {
+        retval = 0.0;
+      }
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return retval;
@@ -52,6 +52,8 @@ private:
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    Bandwidth,
+    FLOPRate,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
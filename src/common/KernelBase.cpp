@@ -33,6 +33,8 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   its_per_rep = -1;
   kernels_per_rep = -1;
   bytes_per_rep = -1;
+  checks_ulp_error = false;
+  ulp_tolerance = 0.0;
   FLOPs_per_rep = -1;
 
   running_variant = NumVariants;
@@ -148,6 +150,7 @@ void KernelBase::setVariantDefined(VariantID vid)
 
   checksum[vid].resize(variant_tuning_names[vid].size(), 0.0);
   num_exec[vid].resize(variant_tuning_names[vid].size(), 0);
+  max_ulp_error[vid].resize(variant_tuning_names[vid].size(), 0.0);
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
   tot_time[vid].resize(variant_tuning_names[vid].size(), 0.0);
@@ -287,6 +290,11 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t its_per_rep = " << its_per_rep << std::endl;
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
+  os << "\t\t\t tuning_bytes_per_rep: " << std::endl;
+  for (auto const& tuning_bytes : tuning_bytes_per_rep) {
+    os << "\t\t\t\t" << tuning_bytes.first
+                     << " : " << tuning_bytes.second << std::endl;
+  }
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
   os << "\t\t\t num_exec: " << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
@@ -26,8 +26,10 @@
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
 #endif
 
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <map>
 #include <iostream>
 #include <limits>
 
@@ -65,7 +67,18 @@ public:
   void setItsPerRep(Index_type its) { its_per_rep = its; };
   void setKernelsPerRep(Index_type nkerns) { kernels_per_rep = nkerns; };
   void setBytesPerRep(Index_type bytes) { bytes_per_rep = bytes;}
+  // Override bytes per rep for tunings that move less (or more) data than
+  // the kernel as a whole, e.g. fused tunings; keyed by tuning name
+  void setTuningBytesPerRep(std::string const& tuning_name, Index_type bytes)
+  { tuning_bytes_per_rep[tuning_name] = bytes; }
   void setFLOPsPerRep(Index_type FLOPs) { FLOPs_per_rep = FLOPs; }
+  // Enable the ULP error check for kernels whose tunings may approximate
+  // math library functions; the max error recorded for each tuning is
+  // checked against the tolerance and shown in the checksum report
+  void setUlpTolerance(Checksum_type ulps)
+  { checks_ulp_error = true; ulp_tolerance = ulps; }
+  void setTuningUlpTolerance(std::string const& tuning_name, Checksum_type ulps)
+  { tuning_ulp_tolerance[tuning_name] = ulps; }
 
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
   void setVariantDefined(VariantID vid);
@@ -106,8 +119,26 @@ public:
   Index_type getItsPerRep() const { return its_per_rep; };
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const
+    {
+      if (hasVariantTuningDefined(vid, tune_idx)) {
+        auto bytes = tuning_bytes_per_rep.find(getVariantTuningName(vid, tune_idx));
+        if (bytes != tuning_bytes_per_rep.end()) { return bytes->second; }
+      }
+      return bytes_per_rep;
+    }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
 
+  bool checksUlpError() const { return checks_ulp_error; }
+  Checksum_type getUlpTolerance(VariantID vid, size_t tune_idx) const
+    {
+      if (hasVariantTuningDefined(vid, tune_idx)) {
+        auto ulps = tuning_ulp_tolerance.find(getVariantTuningName(vid, tune_idx));
+        if (ulps != tuning_ulp_tolerance.end()) { return ulps->second; }
+      }
+      return ulp_tolerance;
+    }
+
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
 
@@ -167,6 +198,7 @@ public:
   double getMaxTime(VariantID vid, size_t tune_idx) const { return max_time[vid].at(tune_idx); }
   double getTotTime(VariantID vid, size_t tune_idx) { return tot_time[vid].at(tune_idx); }
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const { return checksum[vid].at(tune_idx); }
+  Checksum_type getMaxUlpError(VariantID vid, size_t tune_idx) const { return max_ulp_error[vid].at(tune_idx); }
 
   void execute(VariantID vid, size_t tune_idx);
 
@@ -247,6 +279,13 @@ protected:
   std::vector<Checksum_type> checksum[NumVariants];
   Checksum_type checksum_scale_factor;
 
+  // Record max error in ULPs of a tuning's results, e.g. computed with
+  // calcMaxUlpError in updateChecksum, when the ULP error check is enabled
+  void recordUlpError(VariantID vid, size_t tune_idx, Checksum_type ulps)
+  {
+    max_ulp_error[vid].at(tune_idx) = std::max(max_ulp_error[vid].at(tune_idx), ulps);
+  }
+
 private:
   KernelBase() = delete;
 
@@ -273,6 +312,10 @@ private:
   Index_type its_per_rep;
   Index_type kernels_per_rep;
   Index_type bytes_per_rep;
+  std::map<std::string, Index_type> tuning_bytes_per_rep;
+  bool checks_ulp_error;
+  Checksum_type ulp_tolerance;
+  std::map<std::string, Checksum_type> tuning_ulp_tolerance;
   Index_type FLOPs_per_rep;
 
   VariantID running_variant;
@@ -280,6 +323,8 @@ private:
 
   std::vector<int> num_exec[NumVariants];
 
+  std::vector<Checksum_type> max_ulp_error[NumVariants];
+
   RAJA::Timer timer;
 
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Inline math functions and macros for tunings of kernels dominated by
+/// transcendental function calls.
+///
+
+
+#ifndef RAJAPerf_MathUtils_HPP
+#define RAJAPerf_MathUtils_HPP
+
+#include "RPTypes.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+//
+// Ask the compiler to vectorize the following loop. With OpenMP enabled
+// this is 'omp simd', which lets compilers call vector math library
+// variants of functions such as exp (e.g. SVML or glibc libmvec, which
+// needs -ffast-math with gcc). Without OpenMP it expands to nothing.
+//
+#if defined(_OPENMP)
+#define RAJAPERF_SIMD _Pragma("omp simd")
+#else
+#define RAJAPERF_SIMD
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Polynomial approximation of exp(x) that compilers can inline
+ *        and vectorize.
+ *
+ * x is reduced to r = x - n*ln(2) with |r| <= ln(2)/2, exp(r) is
+ * evaluated by its degree 13 Taylor polynomial, and the result is scaled
+ * by 2^n built directly in the exponent bits. Results are within about
+ * one ULP of the math library exp.
+ * Arguments are clamped to [-708, 709], so results past those bounds and
+ * NaN inputs are not handled as in the math library.
+ */
+inline Real_type polyExp(Real_type xin)
+{
+  const double log2e = 1.4426950408889634;
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  // adding and subtracting 1.5*2^52 rounds to the nearest integer, which
+  // is left in the low bits of the sum
+  const double round_shift = 6755399441055744.0;
+
+  const double x = std::min(std::max(static_cast<double>(xin), -708.0), 709.0);
+
+  const double kd = x * log2e + round_shift;
+  const double n = kd - round_shift;
+  const double r = (x - n * ln2_hi) - n * ln2_lo;
+
+  double p = 1.0/6227020800.0;
+  p = p * r + 1.0/479001600.0;
+  p = p * r + 1.0/39916800.0;
+  p = p * r + 1.0/3628800.0;
+  p = p * r + 1.0/362880.0;
+  p = p * r + 1.0/40320.0;
+  p = p * r + 1.0/5040.0;
+  p = p * r + 1.0/720.0;
+  p = p * r + 1.0/120.0;
+  p = p * r + 1.0/24.0;
+  p = p * r + 1.0/6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  std::uint64_t kbits;
+  std::memcpy(&kbits, &kd, sizeof(kbits));
+  const std::uint64_t scale_bits = (kbits << 52) + (std::uint64_t(1023) << 52);
+  double scale;
+  std::memcpy(&scale, &scale_bits, sizeof(scale));
+
+  return static_cast<Real_type>(p * scale);
+}
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
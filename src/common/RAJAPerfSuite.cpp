@@ -42,12 +42,15 @@
 #include "lcals/FIRST_DIFF.hpp"
 #include "lcals/FIRST_MIN.hpp"
 #include "lcals/FIRST_SUM.hpp"
+#include "lcals/FIRST_SUM_RECUR.hpp"
 #include "lcals/GEN_LIN_RECUR.hpp"
+#include "lcals/GEN_LIN_RECUR_SCALAR.hpp"
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
 #include "lcals/INT_PREDICT.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
+#include "lcals/TRIDIAG_ELIM_RECUR.hpp"
 
 //
 // Polybench kernels...
@@ -58,6 +61,7 @@
 #include "polybench/POLYBENCH_ATAX.hpp"
 #include "polybench/POLYBENCH_FDTD_2D.hpp"
 #include "polybench/POLYBENCH_FLOYD_WARSHALL.hpp"
+#include "polybench/POLYBENCH_FLOYD_WARSHALL_IN_PLACE.hpp"
 #include "polybench/POLYBENCH_GEMM.hpp"
 #include "polybench/POLYBENCH_GEMVER.hpp"
 #include "polybench/POLYBENCH_GESUMMV.hpp"
@@ -79,7 +83,7 @@
 // Apps kernels...
 //
 #include "apps/CONVECTION3DPA.hpp"
-#include "apps/WIP-COUPLE.hpp"
+#include "apps/COUPLE.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
 #include "apps/ENERGY.hpp"
@@ -91,6 +95,7 @@
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
 #include "apps/PRESSURE.hpp"
+#include "apps/SPMV.hpp"
 #include "apps/VOL3D.hpp"
 
 //
@@ -102,6 +107,9 @@
 #include "algorithm/REDUCE_SUM.hpp"
 #include "algorithm/MEMSET.hpp"
 #include "algorithm/MEMCPY.hpp"
+#include "algorithm/ATOMIC_CONTENTION.hpp"
+#include "algorithm/GATHER.hpp"
+#include "algorithm/SCATTER.hpp"
 
 
 #include <iostream>
@@ -178,12 +186,15 @@ static const std::string KernelNames [] =
   std::string("Lcals_FIRST_DIFF"),
   std::string("Lcals_FIRST_MIN"),
   std::string("Lcals_FIRST_SUM"),
+  std::string("Lcals_FIRST_SUM_RECUR"),
   std::string("Lcals_GEN_LIN_RECUR"),
+  std::string("Lcals_GEN_LIN_RECUR_SCALAR"),
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
   std::string("Lcals_INT_PREDICT"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
+  std::string("Lcals_TRIDIAG_ELIM_RECUR"),
 
 //
 // Polybench kernels...
@@ -194,6 +205,7 @@ static const std::string KernelNames [] =
   std::string("Polybench_ATAX"),
   std::string("Polybench_FDTD_2D"),
   std::string("Polybench_FLOYD_WARSHALL"),
+  std::string("Polybench_FLOYD_WARSHALL_IN_PLACE"),
   std::string("Polybench_GEMM"),
   std::string("Polybench_GEMVER"),
   std::string("Polybench_GESUMMV"),
@@ -227,6 +239,7 @@ static const std::string KernelNames [] =
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
   std::string("Apps_PRESSURE"),
+  std::string("Apps_SPMV"),
   std::string("Apps_VOL3D"),
 
 //
@@ -238,6 +251,9 @@ static const std::string KernelNames [] =
   std::string("Algorithm_REDUCE_SUM"),
   std::string("Algorithm_MEMSET"),
   std::string("Algorithm_MEMCPY"),
+  std::string("Algorithm_ATOMIC_CONTENTION"),
+  std::string("Algorithm_GATHER"),
+  std::string("Algorithm_SCATTER"),
 
   std::string("Unknown Kernel")  // Keep this at the end and DO NOT remove....
 
@@ -611,10 +627,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::FIRST_SUM(run_params);
        break;
     }
+    case Lcals_FIRST_SUM_RECUR : {
+       kernel = new lcals::FIRST_SUM_RECUR(run_params);
+       break;
+    }
     case Lcals_GEN_LIN_RECUR : {
        kernel = new lcals::GEN_LIN_RECUR(run_params);
        break;
     }
+    case Lcals_GEN_LIN_RECUR_SCALAR : {
+       kernel = new lcals::GEN_LIN_RECUR_SCALAR(run_params);
+       break;
+    }
     case Lcals_HYDRO_1D : {
        kernel = new lcals::HYDRO_1D(run_params);
        break;
@@ -635,6 +659,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::TRIDIAG_ELIM(run_params);
        break;
     }
+    case Lcals_TRIDIAG_ELIM_RECUR : {
+       kernel = new lcals::TRIDIAG_ELIM_RECUR(run_params);
+       break;
+    }
 
 //
 // Polybench kernels...
@@ -663,6 +691,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_FLOYD_WARSHALL(run_params);
        break;
     }
+    case Polybench_FLOYD_WARSHALL_IN_PLACE : {
+       kernel = new polybench::POLYBENCH_FLOYD_WARSHALL_IN_PLACE(run_params);
+       break;
+    }
     case Polybench_GEMM : {
        kernel = new polybench::POLYBENCH_GEMM(run_params);
        break;
@@ -771,6 +803,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::PRESSURE(run_params);
        break;
     }
+    case Apps_SPMV : {
+       kernel = new apps::SPMV(run_params);
+       break;
+    }
     case Apps_VOL3D : {
        kernel = new apps::VOL3D(run_params);
        break;
@@ -803,6 +839,18 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new algorithm::MEMCPY(run_params);
        break;
     }
+    case Algorithm_ATOMIC_CONTENTION: {
+       kernel = new algorithm::ATOMIC_CONTENTION(run_params);
+       break;
+    }
+    case Algorithm_GATHER: {
+       kernel = new algorithm::GATHER(run_params);
+       break;
+    }
+    case Algorithm_SCATTER: {
+       kernel = new algorithm::SCATTER(run_params);
+       break;
+    }
 
     default: {
       getCout() << "\n Unknown Kernel ID = " << kid << std::endl;
@@ -95,12 +95,15 @@ enum KernelID {
   Lcals_FIRST_DIFF,
   Lcals_FIRST_MIN,
   Lcals_FIRST_SUM,
+  Lcals_FIRST_SUM_RECUR,
   Lcals_GEN_LIN_RECUR,
+  Lcals_GEN_LIN_RECUR_SCALAR,
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
   Lcals_INT_PREDICT,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
+  Lcals_TRIDIAG_ELIM_RECUR,
 
 //
 // Polybench kernels...
@@ -111,6 +114,7 @@ enum KernelID {
   Polybench_ATAX,
   Polybench_FDTD_2D,
   Polybench_FLOYD_WARSHALL,
+  Polybench_FLOYD_WARSHALL_IN_PLACE,
   Polybench_GEMM,
   Polybench_GEMVER,
   Polybench_GESUMMV,
@@ -144,6 +148,7 @@ enum KernelID {
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
   Apps_PRESSURE,
+  Apps_SPMV,
   Apps_VOL3D,
 
 //
@@ -155,6 +160,9 @@ enum KernelID {
   Algorithm_REDUCE_SUM,
   Algorithm_MEMSET,
   Algorithm_MEMCPY,
+  Algorithm_ATOMIC_CONTENTION,
+  Algorithm_GATHER,
+  Algorithm_SCATTER,
 
   NumKernels // Keep this one last and NEVER comment out (!!)
 
@@ -35,6 +35,17 @@ RunParams::RunParams(int argc, char** argv)
    size(0.0),
    size_factor(0.0),
    gpu_block_sizes(),
+   atomic_replications(),
+   atomic_spacings(),
+   index_windows(),
+   gemm_tile_sizes(),
+   tile_shapes(),
+   spmv_matrix("stencil_27"),
+   pa_order(0),
+   fir_coefflen(0),
+   domain_aspect({1.0, 1.0, 1.0}),
+   domain_ghosts(0),
+   domain_pad(0),
    pf_tol(0.1),
    checkrun_reps(1),
    reference_variant(),
@@ -102,6 +113,35 @@ void RunParams::print(std::ostream& str) const
   for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
     str << "\n\t" << gpu_block_sizes[j];
   }
+  str << "\n atomic_replications = ";
+  for (size_t j = 0; j < atomic_replications.size(); ++j) {
+    str << "\n\t" << atomic_replications[j];
+  }
+  str << "\n atomic_spacings = ";
+  for (size_t j = 0; j < atomic_spacings.size(); ++j) {
+    str << "\n\t" << atomic_spacings[j];
+  }
+  str << "\n index_windows = ";
+  for (size_t j = 0; j < index_windows.size(); ++j) {
+    str << "\n\t" << index_windows[j];
+  }
+  str << "\n gemm_tile_sizes = ";
+  for (size_t j = 0; j < gemm_tile_sizes.size(); ++j) {
+    str << "\n\t" << gemm_tile_sizes[j];
+  }
+  str << "\n tile_shapes = ";
+  for (size_t j = 0; j < tile_shapes.size(); ++j) {
+    str << "\n\t" << tile_shapes[j].first << "x" << tile_shapes[j].second;
+  }
+  str << "\n spmv_matrix = " << spmv_matrix;
+  str << "\n pa_order = " << pa_order;
+  str << "\n fir_coefflen = " << fir_coefflen;
+  str << "\n domain_aspect = ";
+  for (size_t j = 0; j < domain_aspect.size(); ++j) {
+    str << "\n\t" << domain_aspect[j];
+  }
+  str << "\n domain_ghosts = " << domain_ghosts;
+  str << "\n domain_pad = " << domain_pad;
   str << "\n pf_tol = " << pf_tol;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
@@ -347,6 +387,307 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--atomic_replication") ) {
+
+      bool got_something = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_something = true;
+          int atomic_replication = ::atoi( opt.c_str() );
+          if ( atomic_replication <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --atomic_replication POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            atomic_replications.push_back(atomic_replication);
+          }
+          ++i;
+        }
+      }
+      if (!got_something) {
+        getCout() << "\nBad input:"
+                  << " must give --atomic_replication one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--atomic_spacing") ) {
+
+      bool got_something = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_something = true;
+          int atomic_spacing = ::atoi( opt.c_str() );
+          if ( atomic_spacing <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --atomic_spacing POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            atomic_spacings.push_back(atomic_spacing);
+          }
+          ++i;
+        }
+      }
+      if (!got_something) {
+        getCout() << "\nBad input:"
+                  << " must give --atomic_spacing one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--index_window") ) {
+
+      bool got_something = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_something = true;
+          int index_window = ::atoi( opt.c_str() );
+          if ( index_window <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --index_window POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            index_windows.push_back(index_window);
+          }
+          ++i;
+        }
+      }
+      if (!got_something) {
+        getCout() << "\nBad input:"
+                  << " must give --index_window one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--gemm_tile_size") ) {
+
+      bool got_something = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_something = true;
+          int gemm_tile_size = ::atoi( opt.c_str() );
+          if ( gemm_tile_size <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --gemm_tile_size POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            gemm_tile_sizes.push_back(gemm_tile_size);
+          }
+          ++i;
+        }
+      }
+      if (!got_something) {
+        getCout() << "\nBad input:"
+                  << " must give --gemm_tile_size one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tile_shape") ) {
+
+      bool got_something = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_something = true;
+          size_t xpos = opt.find('x');
+          int rows = 0;
+          int cols = 0;
+          if ( xpos != std::string::npos ) {
+            rows = ::atoi( opt.substr(0, xpos).c_str() );
+            cols = ::atoi( opt.substr(xpos+1).c_str() );
+          }
+          if ( rows <= 0 || cols <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --tile_shape values of the form"
+                      << " <rows>x<cols> with POSITIVE ints"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            tile_shapes.emplace_back(rows, cols);
+          }
+          ++i;
+        }
+      }
+      if (!got_something) {
+        getCout() << "\nBad input:"
+                  << " must give --tile_shape one or more values (<rows>x<cols>)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--spmv_matrix") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        if ( opt == std::string("stencil_7") ||
+             opt == std::string("stencil_27") ||
+             opt == std::string("random") ) {
+          spmv_matrix = opt;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --spmv_matrix one of stencil_7, stencil_27, or random"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --spmv_matrix a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--pa_order") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        int order = ::atoi( opt.c_str() );
+        if ( order >= 1 && order <= 6 ) {
+          pa_order = order;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --pa_order a value from 1 to 6 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --pa_order a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fir_coefflen") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        int coefflen = ::atoi( opt.c_str() );
+        if ( coefflen >= 4 && coefflen <= 256 ) {
+          fir_coefflen = coefflen;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --fir_coefflen a value from 4 to 256 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --fir_coefflen a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--domain_aspect") ) {
+
+      std::vector<double> aspect;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          double a = ::atof( opt.c_str() );
+          if ( a <= 0.0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --domain_aspect POSITIVE values (double)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            aspect.push_back(a);
+          }
+          ++i;
+        }
+      }
+      if ( aspect.size() == 2 || aspect.size() == 3 ) {
+        aspect.resize(3, 1.0);
+        domain_aspect = aspect;
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --domain_aspect two or three values (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--domain_ghosts") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        int ghosts = ::atoi( opt.c_str() );
+        if ( ghosts >= 1 && ghosts <= 8 ) {
+          domain_ghosts = ghosts;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --domain_ghosts a value from 1 to 8 (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --domain_ghosts a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--domain_pad") ) {
+
+      i++;
+      if ( i < argc ) {
+        opt = std::string(argv[i]);
+        int pad = ::atoi( opt.c_str() );
+        if ( pad >= 0 && opt.at(0) != '-' ) {
+          domain_pad = pad;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --domain_pad a NON-NEGATIVE value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --domain_pad a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--pass-fail-tol") ||
                 opt == std::string("-pftol") ) {
 
@@ -597,6 +938,72 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --gpu_block_size 128 256 512 (runs kernels with gpu_block_size 128, 256, and 512)\n\n";
 
+  str << "\t --atomic_replication <space-separated ints> [no default]\n"
+      << "\t      (number of distinct addresses targeted by atomic kernel tunings)\n"
+      << "\t      (kernels not supporting atomic replication will ignore this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --atomic_replication 1 64 4096 (runs atomic tunings with 1, 64, and 4096 target addresses)\n\n";
+
+  str << "\t --atomic_spacing <space-separated ints> [no default]\n"
+      << "\t      (distance in Real_type elements between atomic target addresses)\n"
+      << "\t      (kernels not supporting atomic spacing will ignore this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --atomic_spacing 1 8 (runs atomic tunings with adjacent targets and targets 8 elements apart)\n\n";
+
+  str << "\t --index_window <space-separated ints> [no default]\n"
+      << "\t      (locality window in elements for strided and blocked random index pattern tunings)\n"
+      << "\t      (kernels not supporting index patterns will ignore this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --index_window 8 512 (runs index pattern tunings with windows of 8 and 512 elements)\n\n";
+
+  str << "\t --gemm_tile_size <space-separated ints> [default is 32 64 128]\n"
+      << "\t      (tile sizes swept by tiled matrix multiply and Floyd-Warshall tunings)\n"
+      << "\t      (kernels not supporting tiled tunings will ignore this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --gemm_tile_size 48 96 (runs tiled tunings with 48x48 and 96x96 tiles)\n\n";
+
+  str << "\t --tile_shape <space-separated <rows>x<cols>> [default is 8x256 32x128 64x64]\n"
+      << "\t      (tile shapes swept by tiled and fused 2D stencil tunings)\n"
+      << "\t      (kernels not supporting tiled tunings will ignore this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --tile_shape 4x1024 16x512 (runs tiled tunings with 4x1024 and 16x512 tiles)\n\n";
+
+  str << "\t --spmv_matrix <string> [default is stencil_27]\n"
+      << "\t      (matrix used by sparse matrix-vector kernels: stencil_7, stencil_27, or random)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --spmv_matrix stencil_7 (runs sparse kernels with the 7-point stencil matrix)\n\n";
+
+  str << "\t --pa_order <int> [default is each kernel's own order]\n"
+      << "\t      (polynomial order, 1 to 6, of partial assembly FEM kernels;\n"
+      << "\t       order p uses p+1 dofs and p+2 quadrature points in 1D)\n"
+      << "\t      (GPU variants of these kernels only run at their default order)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --pa_order 5 (runs MASS3DPA, DIFFUSION3DPA, CONVECTION3DPA at order 5)\n\n";
+
+  str << "\t --fir_coefflen <int> [default is 16]\n"
+      << "\t      (number of filter coefficients, 4 to 256, used by FIR)\n"
+      << "\t      (GPU variants of FIR only run with the default length)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --fir_coefflen 128 (runs FIR with a 128 tap filter)\n\n";
+
+  str << "\t --domain_aspect <space-separated doubles> [default is 1 1 1]\n"
+      << "\t      (relative i, j, and k extents of the meshes used by VOL3D,\n"
+      << "\t       DEL_DOT_VEC_2D, NODAL_ACCUMULATION_3D, SPMV, and COUPLE;\n"
+      << "\t       the number of zones stays about the same)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --domain_aspect 4 1 1 (runs with meshes 4x longer in i than in j and k)\n\n";
+
+  str << "\t --domain_ghosts <int> [default is 2 low side, 1 high side]\n"
+      << "\t      (ghost zone width, 1 to 8, on each side of those meshes)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --domain_ghosts 3\n\n";
+
+  str << "\t --domain_pad <int> [default is 0]\n"
+      << "\t      (entries added to the row and plane strides of those meshes,\n"
+      << "\t       e.g., to avoid cache set aliasing of power-of-two strides)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --domain_pad 8 (pads strides by one 64-byte line of doubles)\n\n";
+
   str << "\t --pass-fail-tol, -pftol <double> [default is 0.1; i.e., 10%]\n"
       << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report)\n";
   str << "\t\t Example...\n"
@@ -674,10 +1081,7 @@ void RunParams::printKernelNames(std::ostream& str) const
   str << "\nAvailable kernels:";
   str << "\n------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -688,10 +1092,7 @@ void RunParams::printFullKernelNames(std::ostream& str) const
   str << "\nAvailable kernels (<group name>_<kernel name>):";
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -737,14 +1138,11 @@ void RunParams::printFeatureKernels(std::ostream& str) const
     str << getFeatureName(tfid) << std::endl;
     for (int kid = 0; kid < NumKernels; ++kid) {
       KernelID tkid = static_cast<KernelID>(kid);
-///   RDH DISABLE COUPLE KERNEL
-      if (tkid != Apps_COUPLE) {
-         KernelBase* kern = getKernelObject(tkid, *this);
-         if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFullKernelName(tkid) << std::endl;
-         }
-         delete kern;
+      KernelBase* kern = getKernelObject(tkid, *this);
+      if ( kern->usesFeature(tfid) ) {
+        str << "\t" << getFullKernelName(tkid) << std::endl;
       }
+      delete kern;
     }  // loop over kernels
     str << std::endl;
   }  // loop over features
@@ -757,18 +1155,15 @@ void RunParams::printKernelFeatures(std::ostream& str) const
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
     KernelID tkid = static_cast<KernelID>(kid);
-/// RDH DISABLE COUPLE KERNEL
-    if (tkid != Apps_COUPLE) {
-      str << getFullKernelName(tkid) << std::endl;
-      KernelBase* kern = getKernelObject(tkid, *this);
-      for (int fid = 0; fid < NumFeatures; ++fid) {
-        FeatureID tfid = static_cast<FeatureID>(fid);
-        if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFeatureName(tfid) << std::endl;
-        }
-      }  // loop over features
-      delete kern;
-    }
+    str << getFullKernelName(tkid) << std::endl;
+    KernelBase* kern = getKernelObject(tkid, *this);
+    for (int fid = 0; fid < NumFeatures; ++fid) {
+      FeatureID tfid = static_cast<FeatureID>(fid);
+      if ( kern->usesFeature(tfid) ) {
+         str << "\t" << getFeatureName(tfid) << std::endl;
+      }
+    }  // loop over features
+    delete kern;
   }  // loop over kernels
   str.flush();
 }
@@ -11,6 +11,7 @@
 
 #include <string>
 #include <vector>
+#include <utility>
 #include <iosfwd>
 
 #include "RAJAPerfSuite.hpp"
@@ -136,6 +137,33 @@ public:
     return false;
   }
 
+  const std::vector<size_t>& getAtomicReplications() const
+  { return atomic_replications; }
+
+  const std::vector<size_t>& getAtomicSpacings() const
+  { return atomic_spacings; }
+
+  const std::vector<size_t>& getIndexWindows() const
+  { return index_windows; }
+
+  const std::vector<size_t>& getGemmTileSizes() const
+  { return gemm_tile_sizes; }
+
+  const std::vector<std::pair<size_t, size_t>>& getTileShapes() const
+  { return tile_shapes; }
+
+  const std::string& getSpmvMatrix() const { return spmv_matrix; }
+
+  int getPAOrder() const { return pa_order; }
+
+  int getFIRCoeffLen() const { return fir_coefflen; }
+
+  const std::vector<double>& getDomainAspect() const { return domain_aspect; }
+
+  int getDomainGhosts() const { return domain_ghosts; }
+
+  int getDomainPad() const { return domain_pad; }
+
   double getPFTolerance() const { return pf_tol; }
 
   int getCheckRunReps() const { return checkrun_reps; }
@@ -233,6 +261,17 @@ private:
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
   std::vector<size_t> gpu_block_sizes; /*!< Block sizes for gpu tunings to run (input option) */
+  std::vector<size_t> atomic_replications; /*!< Num distinct atomic addresses for atomic tunings to run (input option) */
+  std::vector<size_t> atomic_spacings; /*!< Spacing of atomic addresses for atomic tunings to run (input option) */
+  std::vector<size_t> index_windows; /*!< Locality windows for index pattern tunings to run (input option) */
+  std::vector<size_t> gemm_tile_sizes; /*!< Tile sizes for tiled matrix multiply and Floyd-Warshall tunings to run (input option) */
+  std::vector<std::pair<size_t, size_t>> tile_shapes; /*!< Row by column tile shapes for tiled 2D stencil tunings to run (input option) */
+  std::string spmv_matrix; /*!< Matrix used by sparse matrix-vector kernels (input option) */
+  int pa_order;          /*!< Polynomial order of partial assembly FEM kernels, 0 for kernel default (input option) */
+  int fir_coefflen;      /*!< Number of FIR filter coefficients, 0 for kernel default (input option) */
+  std::vector<double> domain_aspect; /*!< Relative i, j, k extents of ADomain meshes (input option) */
+  int domain_ghosts;     /*!< Ghost zone width of ADomain meshes, 0 for default (input option) */
+  int domain_pad;        /*!< Padding added to ADomain row and plane strides (input option) */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -91,5 +92,99 @@ void DIFF_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+template < size_t block_size >
+void DIFF_PREDICT::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DIFF_PREDICT_DATA_SETUP;
+  RAJA_UNUSED_VAR(offset);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = ibegin; ib < iend; ib += block_size) {
+          Real_ptr pxb = px + ib * 14;
+          Real_ptr cxb = cx + ib * 14;
+          const Index_type iiend = std::min(static_cast<Index_type>(block_size), iend - ib);
+          for (Index_type ii = 0; ii < iiend; ++ii ) {
+            DIFF_PREDICT_BODY_BLOCKED;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DIFF_PREDICT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBlocked<1>(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBlocked<8>(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBlocked<16>(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void DIFF_PREDICT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addLayoutTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -86,5 +87,93 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < size_t block_size >
+void DIFF_PREDICT::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DIFF_PREDICT_DATA_SETUP;
+  RAJA_UNUSED_VAR(offset);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ib = ibegin; ib < iend; ib += block_size) {
+          Real_ptr pxb = px + ib * 14;
+          Real_ptr cxb = cx + ib * 14;
+          const Index_type iiend = std::min(static_cast<Index_type>(block_size), iend - ib);
+          for (Index_type ii = 0; ii < iiend; ++ii ) {
+            DIFF_PREDICT_BODY_BLOCKED;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantBlocked<1>(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantBlocked<8>(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantBlocked<16>(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void DIFF_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addLayoutTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -11,6 +11,9 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -57,10 +60,28 @@ DIFF_PREDICT::~DIFF_PREDICT()
 {
 }
 
-void DIFF_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::setUp(VariantID vid, size_t tune_idx)
 {
   m_array_length = getActualProblemSize() * 14;
   m_offset = getActualProblemSize();
+  m_block_size = getLayoutBlockSize(vid, tune_idx);
+
+  if (m_block_size > 0) {
+
+    const Index_type planar_length = m_array_length;
+    m_array_length = getBlockedLength(getActualProblemSize(), 14, m_block_size);
+
+    allocAndInitDataConst(m_px, m_array_length, 0.0, vid);
+
+    Real_ptr cx_planar;
+    allocAndInitData(cx_planar, planar_length, vid);
+    allocAndInitDataConst(m_cx, m_array_length, 0.0, vid);
+    copyPlanarToBlocked(m_cx, cx_planar, getActualProblemSize(), 14, m_block_size);
+
+    deallocData(cx_planar);
+
+    return;
+  }
 
   allocAndInitDataConst(m_px, m_array_length, 0.0, vid);
   allocAndInitData(m_cx, m_array_length, vid);
@@ -68,6 +89,16 @@ void DIFF_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void DIFF_PREDICT::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if (m_block_size > 0) {
+
+    std::vector<Real_type> px_planar(getActualProblemSize() * 14);
+    copyBlockedToPlanar(px_planar.data(), m_px, getActualProblemSize(), 14, m_block_size);
+
+    checksum[vid][tune_idx] += calcChecksum(px_planar.data(), getActualProblemSize() * 14);
+
+    return;
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_px, m_array_length);
 }
 
@@ -78,5 +109,27 @@ void DIFF_PREDICT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_cx);
 }
 
+void DIFF_PREDICT::addLayoutTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "aos");
+    addVariantTuningName(vid, "soa_block_8");
+    addVariantTuningName(vid, "soa_block_16");
+  }
+}
+
+Index_type DIFF_PREDICT::getLayoutBlockSize(VariantID vid, size_t tune_idx) const
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  if (tuning_name == "aos") {
+    return 1;
+  } else if (tuning_name == "soa_block_8") {
+    return 8;
+  } else if (tuning_name == "soa_block_16") {
+    return 16;
+  }
+  return 0;
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
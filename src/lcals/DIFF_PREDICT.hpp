@@ -33,6 +33,13 @@
 ///   px[i + offset * 12] = cr;
 /// }
 ///
+/// The "aos" tuning of the Base variants stores the 14 values of each
+/// element together (interleaved), and the "soa_block_8" and
+/// "soa_block_16" tunings store blocks of 8 or 16 elements with each plane
+/// contiguous within a block (blocked SoA), see getBlockedIndex. setUp
+/// copies the data into the layout and the checksum is computed on data
+/// copied back to planar order, so checksums match the default tuning.
+///
 
 #ifndef RAJAPerf_Lcals_DIFF_PREDICT_HPP
 #define RAJAPerf_Lcals_DIFF_PREDICT_HPP
@@ -66,6 +73,29 @@
   px[i + offset * 13] = cr - px[i + offset * 12]; \
   px[i + offset * 12] = cr;
 
+#define DIFF_PREDICT_BODY_BLOCKED  \
+  Real_type ar, br, cr; \
+\
+  ar                        = cxb[ii + block_size * 4];       \
+  br                        = ar - pxb[ii + block_size * 4];  \
+  pxb[ii + block_size * 4]  = ar;                             \
+  cr                        = br - pxb[ii + block_size * 5];  \
+  pxb[ii + block_size * 5]  = br;                             \
+  ar                        = cr - pxb[ii + block_size * 6];  \
+  pxb[ii + block_size * 6]  = cr;                             \
+  br                        = ar - pxb[ii + block_size * 7];  \
+  pxb[ii + block_size * 7]  = ar;                             \
+  cr                        = br - pxb[ii + block_size * 8];  \
+  pxb[ii + block_size * 8]  = br;                             \
+  ar                        = cr - pxb[ii + block_size * 9];  \
+  pxb[ii + block_size * 9]  = cr;                             \
+  br                        = ar - pxb[ii + block_size * 10]; \
+  pxb[ii + block_size * 10] = ar;                             \
+  cr                        = br - pxb[ii + block_size * 11]; \
+  pxb[ii + block_size * 11] = br;                             \
+  pxb[ii + block_size * 13] = cr - pxb[ii + block_size * 12]; \
+  pxb[ii + block_size * 12] = cr;
+
 
 #include "common/KernelBase.hpp"
 
@@ -95,8 +125,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runSeqVariantBlocked(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runOpenMPVariantBlocked(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -106,11 +144,15 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addLayoutTuningNames(VariantID vid);
+  Index_type getLayoutBlockSize(VariantID vid, size_t tune_idx) const;
+
   Real_ptr m_px;
   Real_ptr m_cx;
 
   Index_type m_array_length;
   Index_type m_offset;
+  Index_type m_block_size;
 };
 
 } // end namespace lcals
@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +19,7 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -117,5 +118,185 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void FIRST_MIN::runOpenMPVariantSimd(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      ::std::vector<MyMinLoc> thread_min(omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        int nthreads = 1;
+
+        #pragma omp parallel
+        {
+          const int p = omp_get_num_threads();
+          const int pid = omp_get_thread_num();
+          const Index_type n = iend - ibegin;
+          const Index_type local_begin = ibegin + (n * pid) / p;
+          const Index_type local_end = ibegin + (n * (pid + 1)) / p;
+          const Index_type local_simd = local_begin +
+            ((local_end - local_begin) / FIRST_MIN_SIMD_WIDTH) * FIRST_MIN_SIMD_WIDTH;
+
+          FIRST_MIN_MINLOC_INIT;
+          FIRST_MIN_SIMD_INIT;
+
+          for (Index_type i = local_begin; i < local_simd; i += FIRST_MIN_SIMD_WIDTH ) {
+            FIRST_MIN_SIMD_BODY;
+          }
+
+          FIRST_MIN_SIMD_COMBINE;
+
+          for (Index_type i = local_simd; i < local_end; ++i ) {
+            FIRST_MIN_BODY;
+          }
+
+          thread_min[pid] = mymin;
+
+          if (pid == 0) {
+            nthreads = p;
+          }
+        }
+
+        // thread partials are in index order, so a strict compare keeps
+        // the first location of the min
+        MyMinLoc mymin = thread_min[0];
+        for (int pid = 1; pid < nthreads; ++pid) {
+          if ( thread_min[pid].val < mymin.val ) {
+            mymin = thread_min[pid];
+          }
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIRST_MIN::runOpenMPVariantTwoPass(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type xmin = m_xmin_init;
+
+        #pragma omp parallel for simd reduction(min:xmin)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          FIRST_MIN_VAL_BODY;
+        }
+
+        Index_type loc = iend;
+
+        #pragma omp parallel reduction(min:loc)
+        {
+          const int p = omp_get_num_threads();
+          const int pid = omp_get_thread_num();
+          const Index_type n = iend - ibegin;
+          const Index_type local_begin = ibegin + (n * pid) / p;
+          const Index_type local_end = ibegin + (n * (pid + 1)) / p;
+
+          for (Index_type i = local_begin; i < local_end; ++i ) {
+            if ( x[i] == xmin ) {
+              loc = i;
+              break;
+            }
+          }
+        }
+
+        m_minloc = (loc < iend) ? loc : m_initloc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantSimd(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTwoPass(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIRST_MIN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addMinLocTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -18,7 +18,7 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -104,5 +104,146 @@ void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void FIRST_MIN::runSeqVariantSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+  const Index_type isimd = ibegin +
+    ((iend - ibegin) / FIRST_MIN_SIMD_WIDTH) * FIRST_MIN_SIMD_WIDTH;
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+        FIRST_MIN_SIMD_INIT;
+
+        for (Index_type i = ibegin; i < isimd; i += FIRST_MIN_SIMD_WIDTH ) {
+          FIRST_MIN_SIMD_BODY;
+        }
+
+        FIRST_MIN_SIMD_COMBINE;
+
+        for (Index_type i = isimd; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = mymin.loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIRST_MIN::runSeqVariantTwoPass(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+  const Index_type isimd = ibegin +
+    ((iend - ibegin) / FIRST_MIN_SIMD_WIDTH) * FIRST_MIN_SIMD_WIDTH;
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_SIMD_VAL_INIT;
+
+        for (Index_type i = ibegin; i < isimd; i += FIRST_MIN_SIMD_WIDTH ) {
+          FIRST_MIN_SIMD_VAL_BODY;
+        }
+
+        Real_type xmin = m_xmin_init;
+        for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) {
+          xmin = vmin[v] < xmin ? vmin[v] : xmin;
+        }
+        for (Index_type i = isimd; i < iend; ++i ) {
+          FIRST_MIN_VAL_BODY;
+        }
+
+        Index_type loc = m_initloc;
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          if ( x[i] == xmin ) {
+            loc = i;
+            break;
+          }
+        }
+
+        m_minloc = loc;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIRST_MIN::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantSimd(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantTwoPass(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIRST_MIN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addMinLocTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
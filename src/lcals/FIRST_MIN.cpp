@@ -36,6 +36,11 @@ FIRST_MIN::FIRST_MIN(const RunParams& params)
   setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) +
                   (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N );
+  // the second pass reads x up to the first min, counted here as all of x
+  setTuningBytesPerRep( "two_pass",
+                        (1*sizeof(Real_type ) + 1*sizeof(Real_type )) +
+                        (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
+                        (0*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N );
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -85,5 +90,13 @@ void FIRST_MIN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_x);
 }
 
+void FIRST_MIN::addMinLocTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "simd");
+    addVariantTuningName(vid, "two_pass");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
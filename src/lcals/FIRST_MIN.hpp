@@ -17,6 +17,16 @@
 ///   if ( x[i] < x[loc] ) loc = i;
 /// }
 ///
+/// The Seq and OpenMP tunings are
+///   default  - one element at a time with a branch, as above
+///   simd     - FIRST_MIN_SIMD_WIDTH lanes that each keep a min value and
+///              location, updated with branch-free selects so the loop
+///              vectorizes; the lanes (and thread partials in OpenMP) are
+///              combined at the end
+///   two_pass - a min value reduction, then a search for the first
+///              element equal to the min
+/// Every tuning finds the first location of the min value.
+///
 
 #ifndef RAJAPerf_Lcals_FIRST_MIN_HPP
 #define RAJAPerf_Lcals_FIRST_MIN_HPP
@@ -35,6 +45,47 @@
 #define FIRST_MIN_BODY_RAJA  \
   loc.minloc(x[i], i);
 
+#define FIRST_MIN_SIMD_WIDTH (8)
+
+#define FIRST_MIN_SIMD_VAL_INIT \
+  Real_type vmin[FIRST_MIN_SIMD_WIDTH]; \
+  for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) { \
+    vmin[v] = m_xmin_init; \
+  }
+
+#define FIRST_MIN_SIMD_INIT \
+  FIRST_MIN_SIMD_VAL_INIT; \
+  Index_type vloc[FIRST_MIN_SIMD_WIDTH]; \
+  for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) { \
+    vloc[v] = m_initloc; \
+  }
+
+// Elements i to i + FIRST_MIN_SIMD_WIDTH - 1, one per lane
+#define FIRST_MIN_SIMD_BODY \
+  for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) { \
+    const bool lt = x[i+v] < vmin[v]; \
+    vmin[v] = lt ? x[i+v] : vmin[v]; \
+    vloc[v] = lt ? i+v : vloc[v]; \
+  }
+
+// Keeps the smallest location among lanes holding the min value
+#define FIRST_MIN_SIMD_COMBINE \
+  for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) { \
+    if ( vmin[v] < mymin.val || \
+         ( vmin[v] == mymin.val && vloc[v] < mymin.loc ) ) { \
+      mymin.val = vmin[v]; \
+      mymin.loc = vloc[v]; \
+    } \
+  }
+
+#define FIRST_MIN_SIMD_VAL_BODY \
+  for (Index_type v = 0; v < FIRST_MIN_SIMD_WIDTH; ++v ) { \
+    vmin[v] = x[i+v] < vmin[v] ? x[i+v] : vmin[v]; \
+  }
+
+#define FIRST_MIN_VAL_BODY \
+  xmin = x[i] < xmin ? x[i] : xmin;
+
 
 #include "common/RPTypes.hpp"
 
@@ -81,8 +132,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSimd(VariantID vid);
+  void runSeqVariantTwoPass(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSimd(VariantID vid);
+  void runOpenMPVariantTwoPass(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -92,6 +151,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addMinLocTuningNames(VariantID vid);
+
   Real_ptr m_x;
   Real_type m_xmin_init;
   Index_type m_initloc;
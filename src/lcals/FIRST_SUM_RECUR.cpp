@@ -0,0 +1,74 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_SUM_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+FIRST_SUM_RECUR::FIRST_SUM_RECUR(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_FIRST_SUM_RECUR, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(2000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * (m_N-1) +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N );
+  setFLOPsPerRep(1 * (getActualProblemSize()-1));
+
+  // x grows linearly with N, as in the SCAN kernel
+  checksum_scale_factor = 1e-2 *
+                 ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                              getActualProblemSize() ) /
+                 getActualProblemSize();
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+FIRST_SUM_RECUR::~FIRST_SUM_RECUR()
+{
+}
+
+void FIRST_SUM_RECUR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataConst(m_x, m_N, 0.0, vid);
+  allocAndInitData(m_y, m_N, vid);
+  m_x[0] = m_y[0];
+}
+
+void FIRST_SUM_RECUR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor);
+}
+
+void FIRST_SUM_RECUR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
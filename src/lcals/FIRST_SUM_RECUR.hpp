@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FIRST_SUM_RECUR kernel reference implementation:
+///
+/// Note: this is the original first-order recurrence that the FIRST_SUM
+///       kernel alters to enable parallelism; x[0] = y[0].
+///
+/// for (Index_type i = 1; i < N; ++i ) {
+///   x[i] = x[i-1] + y[i];
+/// }
+///
+/// The Base_OpenMP variant solves the recurrence as a scan. Each step is
+/// the map x -> x + y[i], so each thread sums y over its chunk, the chunk
+/// sums are combined across threads as in the SCAN kernel, and each thread
+/// then runs the recurrence over its chunk from its incoming value.
+///
+
+#ifndef RAJAPerf_Lcals_FIRST_SUM_RECUR_HPP
+#define RAJAPerf_Lcals_FIRST_SUM_RECUR_HPP
+
+
+#define FIRST_SUM_RECUR_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define FIRST_SUM_RECUR_BODY  \
+  x[i] = x[i-1] + y[i];
+
+#define FIRST_SUM_RECUR_CHUNK_BODY  \
+  xprev += y[i]; \
+  x[i] = xprev;
+
+#define FIRST_SUM_RECUR_CHUNK_MAP_BODY  \
+  b += y[i];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class FIRST_SUM_RECUR : public KernelBase
+{
+public:
+
+  FIRST_SUM_RECUR(const RunParams& params);
+
+  ~FIRST_SUM_RECUR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_RECUR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_RECUR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_RECUR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,91 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR_SCALAR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "LcalsData.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void GEN_LIN_RECUR_SCALAR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  GEN_LIN_RECUR_SCALAR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int p0 = getAffineScanNumThreads(N);
+      ::std::vector<Real_type> thread_a(p0);
+      ::std::vector<Real_type> thread_b(p0);
+
+      auto map_body1 = [=](Index_type k, Real_type& a, Real_type& b) {
+        GEN_LIN_RECUR_SCALAR_MAP_BODY1;
+      };
+
+      auto chunk_body1 = [=](Index_type begin, Index_type end, Real_type stb5) {
+        for (Index_type k = begin; k < end; ++k ) {
+          GEN_LIN_RECUR_SCALAR_BODY1;
+        }
+        return stb5;
+      };
+
+      auto map_body2 = [=](Index_type i, Real_type& a, Real_type& b) {
+        GEN_LIN_RECUR_SCALAR_MAP_BODY2;
+      };
+
+      auto chunk_body2 = [=](Index_type begin, Index_type end, Real_type stb5) {
+        for (Index_type i = begin; i < end; ++i ) {
+          GEN_LIN_RECUR_SCALAR_BODY2;
+        }
+        return stb5;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type stb5 = affineScanOpenMP(0, N, stb5_init, p0,
+                                          thread_a.data(), thread_b.data(),
+                                          map_body1, chunk_body1);
+
+        affineScanOpenMP(1, N+1, stb5, p0,
+                         thread_a.data(), thread_b.data(),
+                         map_body2, chunk_body2);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_SCALAR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
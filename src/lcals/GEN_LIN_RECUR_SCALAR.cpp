@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR_SCALAR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+GEN_LIN_RECUR_SCALAR::GEN_LIN_RECUR_SCALAR(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_GEN_LIN_RECUR_SCALAR, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  setBytesPerRep( (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N +
+                  (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N );
+  setFLOPsPerRep((3 +
+                  3 ) * getActualProblemSize());
+
+  checksum_scale_factor = 0.01 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+GEN_LIN_RECUR_SCALAR::~GEN_LIN_RECUR_SCALAR()
+{
+}
+
+void GEN_LIN_RECUR_SCALAR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  m_kb5i = 0;
+
+  allocAndInitDataConst(m_b5, m_N, 0.0, vid);
+  allocAndInitData(m_sa, m_N, vid);
+  allocAndInitData(m_sb, m_N, vid);
+
+  m_stb5_init = m_sa[0];
+}
+
+void GEN_LIN_RECUR_SCALAR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_b5, getActualProblemSize(), checksum_scale_factor );
+}
+
+void GEN_LIN_RECUR_SCALAR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_b5);
+  deallocData(m_sa);
+  deallocData(m_sb);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GEN_LIN_RECUR_SCALAR kernel reference implementation:
+///
+/// Note: this is the original recurrence that the GEN_LIN_RECUR kernel
+///       alters to enable parallelism; stb5 is a scalar carried through
+///       both loops, starting from stb5_init = sa[0] each rep.
+///
+/// Index_type kb5i = 0;
+/// Real_type stb5 = stb5_init;
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   b5[k+kb5i] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k+kb5i] - stb5;
+/// }
+///
+/// for (Index_type i = 1; i < N+1; ++i ) {
+///   Index_type k = N - i ;
+///   b5[k+kb5i] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k+kb5i] - stb5;
+/// }
+///
+/// The Base_OpenMP variant solves each loop as a scan. Each step is the
+/// affine map stb5 -> (sb[k]-1)*stb5 + sa[k]; each thread composes the maps
+/// of its chunk, the composed maps are combined across threads as in the
+/// SCAN kernel, and each thread then runs the recurrence over its chunk
+/// from its incoming value.
+///
+
+#ifndef RAJAPerf_Lcals_GEN_LIN_RECUR_SCALAR_HPP
+#define RAJAPerf_Lcals_GEN_LIN_RECUR_SCALAR_HPP
+
+
+#define GEN_LIN_RECUR_SCALAR_DATA_SETUP \
+  Real_ptr b5 = m_b5; \
+  Real_ptr sa = m_sa; \
+  Real_ptr sb = m_sb; \
+  Real_type stb5_init = m_stb5_init; \
+\
+  Index_type kb5i = m_kb5i; \
+  Index_type N = m_N;
+
+#define GEN_LIN_RECUR_SCALAR_BODY1  \
+  b5[k+kb5i] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k+kb5i] - stb5;
+
+#define GEN_LIN_RECUR_SCALAR_BODY2  \
+  Index_type k = N - i ; \
+  b5[k+kb5i] = sa[k] + stb5*sb[k]; \
+  stb5 = b5[k+kb5i] - stb5;
+
+#define GEN_LIN_RECUR_SCALAR_MAP_BODY1  \
+  a = ( sb[k] - 1.0 ) * a; \
+  b = sa[k] + ( sb[k] - 1.0 ) * b;
+
+#define GEN_LIN_RECUR_SCALAR_MAP_BODY2  \
+  Index_type k = N - i ; \
+  a = ( sb[k] - 1.0 ) * a; \
+  b = sa[k] + ( sb[k] - 1.0 ) * b;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class GEN_LIN_RECUR_SCALAR : public KernelBase
+{
+public:
+
+  GEN_LIN_RECUR_SCALAR(const RunParams& params);
+
+  ~GEN_LIN_RECUR_SCALAR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_SCALAR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_SCALAR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_SCALAR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Real_ptr m_b5;
+  Real_ptr m_sa;
+  Real_ptr m_sb;
+
+  Real_type m_stb5_init;
+
+  Index_type m_kb5i;
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_2D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -178,5 +180,225 @@ void HYDRO_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+void HYDRO_2D::runOpenMPVariantTiled(VariantID vid,
+                                     Index_type tile_k, Index_type tile_j)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_TILE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for collapse(2) schedule(static)
+          for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+            for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+              const Index_type kt1 = std::min(kt0 + tile_k, kend);
+              const Index_type jt1 = std::min(jt0 + tile_j, jend);
+              for (Index_type k = kt0; k < kt1; ++k ) {
+                for (Index_type j = jt0; j < jt1; ++j ) {
+                  HYDRO_2D_BODY1;
+                }
+              }
+            }
+          }
+
+          #pragma omp for collapse(2) schedule(static)
+          for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+            for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+              const Index_type kt1 = std::min(kt0 + tile_k, kend);
+              const Index_type jt1 = std::min(jt0 + tile_j, jend);
+              for (Index_type k = kt0; k < kt1; ++k ) {
+                for (Index_type j = jt0; j < jt1; ++j ) {
+                  HYDRO_2D_BODY2;
+                }
+              }
+            }
+          }
+
+          #pragma omp for collapse(2) schedule(static)
+          for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+            for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+              const Index_type kt1 = std::min(kt0 + tile_k, kend);
+              const Index_type jt1 = std::min(jt0 + tile_j, jend);
+              for (Index_type k = kt0; k < kt1; ++k ) {
+                for (Index_type j = jt0; j < jt1; ++j ) {
+                  HYDRO_2D_BODY3;
+                }
+              }
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile_k);
+  RAJA_UNUSED_VAR(tile_j);
+#endif
+}
+
+void HYDRO_2D::runOpenMPVariantFused(VariantID vid,
+                                     Index_type tile_k, Index_type tile_j)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_TILE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type ldt = tile_j + 1;
+      const Index_type tile_len = (tile_k + 1) * ldt;
+      std::vector<Real_type> za_tiles(tile_len * omp_get_max_threads());
+      std::vector<Real_type> zb_tiles(tile_len * omp_get_max_threads());
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr zat = za_tiles.data() + tile_len * omp_get_thread_num();
+          Real_ptr zbt = zb_tiles.data() + tile_len * omp_get_thread_num();
+
+          #pragma omp for collapse(2) schedule(static)
+          for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+            for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+              const Index_type kt1 = std::min(kt0 + tile_k, kend);
+              const Index_type jt1 = std::min(jt0 + tile_j, jend);
+
+              for (Index_type k = kt0; k <= kt1; ++k ) {
+                Index_type j = jt0 - 1;
+                Index_type l = (k - kt0)*ldt;
+                if (k < kend && j >= jbeg) {
+                  HYDRO_2D_BODY1_FUSED;
+                } else {
+                  HYDRO_2D_BODY1_FUSED_HALO;
+                }
+                if (k < kend) {
+                  for (j = jt0; j < jt1; ++j ) {
+                    l = (j - jt0 + 1) + (k - kt0)*ldt;
+                    HYDRO_2D_BODY1_FUSED;
+                  }
+                } else {
+                  for (j = jt0; j < jt1; ++j ) {
+                    l = (j - jt0 + 1) + (k - kt0)*ldt;
+                    HYDRO_2D_BODY1_FUSED_HALO;
+                  }
+                }
+              }
+
+              for (Index_type k = kt0; k < kt1; ++k ) {
+                for (Index_type j = jt0; j < jt1; ++j ) {
+                  const Index_type l = (j - jt0 + 1) + (k - kt0)*ldt;
+                  HYDRO_2D_BODY2_FUSED;
+                  HYDRO_2D_BODY3;
+                }
+              }
+
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile_k);
+  RAJA_UNUSED_VAR(tile_j);
+#endif
+}
+
+void HYDRO_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    for (const TileShape& tile : m_tile_shapes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTiled(vid, tile.k, tile.j);
+
+      }
+
+      t += 1;
+
+    }
+
+    for (const TileShape& tile : m_tile_shapes) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantFused(vid, tile.k, tile.j);
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void HYDRO_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addTiledTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
@@ -155,5 +157,196 @@ void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+void HYDRO_2D::runSeqVariantTiled(VariantID vid,
+                                  Index_type tile_k, Index_type tile_j)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_TILE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+          for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+            const Index_type kt1 = std::min(kt0 + tile_k, kend);
+            const Index_type jt1 = std::min(jt0 + tile_j, jend);
+            for (Index_type k = kt0; k < kt1; ++k ) {
+              for (Index_type j = jt0; j < jt1; ++j ) {
+                HYDRO_2D_BODY1;
+              }
+            }
+          }
+        }
+
+        for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+          for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+            const Index_type kt1 = std::min(kt0 + tile_k, kend);
+            const Index_type jt1 = std::min(jt0 + tile_j, jend);
+            for (Index_type k = kt0; k < kt1; ++k ) {
+              for (Index_type j = jt0; j < jt1; ++j ) {
+                HYDRO_2D_BODY2;
+              }
+            }
+          }
+        }
+
+        for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+          for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+            const Index_type kt1 = std::min(kt0 + tile_k, kend);
+            const Index_type jt1 = std::min(jt0 + tile_j, jend);
+            for (Index_type k = kt0; k < kt1; ++k ) {
+              for (Index_type j = jt0; j < jt1; ++j ) {
+                HYDRO_2D_BODY3;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HYDRO_2D::runSeqVariantFused(VariantID vid,
+                                  Index_type tile_k, Index_type tile_j)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_TILE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      const Index_type ldt = tile_j + 1;
+      std::vector<Real_type> za_tile((tile_k + 1) * ldt);
+      std::vector<Real_type> zb_tile((tile_k + 1) * ldt);
+      Real_ptr zat = za_tile.data();
+      Real_ptr zbt = zb_tile.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kt0 = kbeg; kt0 < kend; kt0 += tile_k ) {
+          for (Index_type jt0 = jbeg; jt0 < jend; jt0 += tile_j ) {
+            const Index_type kt1 = std::min(kt0 + tile_k, kend);
+            const Index_type jt1 = std::min(jt0 + tile_j, jend);
+
+            for (Index_type k = kt0; k <= kt1; ++k ) {
+              Index_type j = jt0 - 1;
+              Index_type l = (k - kt0)*ldt;
+              if (k < kend && j >= jbeg) {
+                HYDRO_2D_BODY1_FUSED;
+              } else {
+                HYDRO_2D_BODY1_FUSED_HALO;
+              }
+              if (k < kend) {
+                for (j = jt0; j < jt1; ++j ) {
+                  l = (j - jt0 + 1) + (k - kt0)*ldt;
+                  HYDRO_2D_BODY1_FUSED;
+                }
+              } else {
+                for (j = jt0; j < jt1; ++j ) {
+                  l = (j - jt0 + 1) + (k - kt0)*ldt;
+                  HYDRO_2D_BODY1_FUSED_HALO;
+                }
+              }
+            }
+
+            for (Index_type k = kt0; k < kt1; ++k ) {
+              for (Index_type j = jt0; j < jt1; ++j ) {
+                const Index_type l = (j - jt0 + 1) + (k - kt0)*ldt;
+                HYDRO_2D_BODY2_FUSED;
+                HYDRO_2D_BODY3;
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HYDRO_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    for (const TileShape& tile : m_tile_shapes) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantTiled(vid, tile.k, tile.j);
+
+      }
+
+      t += 1;
+
+    }
+
+    for (const TileShape& tile : m_tile_shapes) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantFused(vid, tile.k, tile.j);
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void HYDRO_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addTiledTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
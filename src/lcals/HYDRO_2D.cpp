@@ -13,6 +13,7 @@
 #include "common/DataUtils.hpp"
 
 #include <cmath>
+#include <string>
 
 
 namespace rajaperf
@@ -20,6 +21,15 @@ namespace rajaperf
 namespace lcals
 {
 
+namespace
+{
+
+std::string getTileShapeName(Index_type tile_k, Index_type tile_j)
+{
+  return std::to_string(tile_k) + "x" + std::to_string(tile_j);
+}
+
+} // end anonymous namespace
 
 HYDRO_2D::HYDRO_2D(const RunParams& params)
   : KernelBase(rajaperf::Lcals_HYDRO_2D, params)
@@ -49,6 +59,22 @@ HYDRO_2D::HYDRO_2D(const RunParams& params)
                   26 +
                   4  ) * (m_jn-2)*(m_kn-2));
 
+  for (const auto& tile_shape : params.getTileShapes()) {
+    m_tile_shapes.push_back({static_cast<Index_type>(tile_shape.first),
+                             static_cast<Index_type>(tile_shape.second)});
+  }
+  if (m_tile_shapes.empty()) {
+    m_tile_shapes = { {8, 256}, {32, 128}, {64, 64} };
+  }
+
+  // fused tunings keep za and zb in tile buffers, the other arrays are
+  // streamed once
+  for (const TileShape& tile : m_tile_shapes) {
+    setTuningBytesPerRep("fused_" + getTileShapeName(tile.k, tile.j),
+        (4*sizeof(Real_type ) + 0*sizeof(Real_type )) * (m_kn-2) * (m_jn-2) +
+        (0*sizeof(Real_type ) + 7*sizeof(Real_type )) * m_array_length );
+  }
+
   checksum_scale_factor = 0.001 *
               ( static_cast<Checksum_type>(getDefaultProblemSize()) /
                                            getActualProblemSize() );
@@ -116,5 +142,17 @@ void HYDRO_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_zz);
 }
 
+void HYDRO_2D::addTiledTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    for (const TileShape& tile : m_tile_shapes) {
+      addVariantTuningName(vid, "tile_" + getTileShapeName(tile.k, tile.j));
+    }
+    for (const TileShape& tile : m_tile_shapes) {
+      addVariantTuningName(vid, "fused_" + getTileShapeName(tile.k, tile.j));
+    }
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
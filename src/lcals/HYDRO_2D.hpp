@@ -38,12 +38,25 @@
 ///   }
 /// }
 ///
+/// The Base_Seq and Base_OpenMP variants have two tunings for each tile
+/// shape (rows in k by columns in j) given with the --tile_shape option:
+///   tile_KxJ  - each of the three loop nests above runs over KxJ tiles
+///   fused_KxJ - for each KxJ tile, za and zb are computed for the tile
+///               plus a one point halo (the column j-1 to the left of the
+///               tile and the row k+1 below it) into tile-local buffers,
+///               then zu and zv are updated and zrout and zzout computed
+///               for the tile
+/// The fused tunings do not store za and zb, so they move less data per
+/// rep than the other tunings; their bytes per rep count only the arrays
+/// read and written by the fused loop. Halo values on the domain
+/// boundary, which the loops above never compute, are read from za and zb.
+///
 
 #ifndef RAJAPerf_Lcals_HYDRO_2D_HPP
 #define RAJAPerf_Lcals_HYDRO_2D_HPP
 
 
-#define HYDRO_2D_DATA_SETUP \
+#define HYDRO_2D_TILE_DATA_SETUP \
   Real_ptr zadat = m_za; \
   Real_ptr zbdat = m_zb; \
   Real_ptr zmdat = m_zm; \
@@ -60,18 +73,28 @@
   const Real_type s = m_s; \
   const Real_type t = m_t; \
 \
-  const Index_type kn = m_kn; \
   const Index_type jn = m_jn;
 
+#define HYDRO_2D_DATA_SETUP \
+  HYDRO_2D_TILE_DATA_SETUP \
+\
+  const Index_type kn = m_kn;
+
+#define HYDRO_2D_ZA_VALUE \
+  ( zpdat[j-1+(k+1)*jn] + zqdat[j-1+(k+1)*jn] - \
+    zpdat[j-1+k*jn] - zqdat[j-1+k*jn] ) * \
+  ( zrdat[j+k*jn] + zrdat[j-1+k*jn] ) / \
+  ( zmdat[j-1+k*jn] + zmdat[j-1+(k+1)*jn] )
+
+#define HYDRO_2D_ZB_VALUE \
+  ( zpdat[j-1+k*jn] + zqdat[j-1+k*jn] - \
+    zpdat[j+k*jn] - zqdat[j+k*jn] ) * \
+  ( zrdat[j+k*jn] + zrdat[j+(k-1)*jn] ) / \
+  ( zmdat[j+k*jn] + zmdat[j-1+k*jn] )
+
 #define HYDRO_2D_BODY1  \
-  zadat[j+k*jn] = ( zpdat[j-1+(k+1)*jn] + zqdat[j-1+(k+1)*jn] - \
-                    zpdat[j-1+k*jn] - zqdat[j-1+k*jn] ) * \
-                  ( zrdat[j+k*jn] + zrdat[j-1+k*jn] ) / \
-                  ( zmdat[j-1+k*jn] + zmdat[j-1+(k+1)*jn] ); \
-  zbdat[j+k*jn] = ( zpdat[j-1+k*jn] + zqdat[j-1+k*jn] - \
-                    zpdat[j+k*jn] - zqdat[j+k*jn] ) * \
-                  ( zrdat[j+k*jn] + zrdat[j+(k-1)*jn] ) / \
-                  ( zmdat[j+k*jn] + zmdat[j-1+k*jn] );
+  zadat[j+k*jn] = HYDRO_2D_ZA_VALUE; \
+  zbdat[j+k*jn] = HYDRO_2D_ZB_VALUE;
 
 #define HYDRO_2D_BODY2 \
   zudat[j+k*jn] += s*( zadat[j+k*jn] * ( zzdat[j+k*jn] - zzdat[j+1+k*jn] ) - \
@@ -87,6 +110,29 @@
   zroutdat[j+k*jn] = zrdat[j+k*jn] + t*zudat[j+k*jn]; \
   zzoutdat[j+k*jn] = zzdat[j+k*jn] + t*zvdat[j+k*jn]; \
 
+//
+// Fused tunings keep za and zb for a tile and its halo in the buffers
+// zat and zbt with row stride ldt, where point (k, j) is at index
+// l = (j - jt0 + 1) + (k - kt0)*ldt for a tile starting at (kt0, jt0).
+//
+#define HYDRO_2D_BODY1_FUSED \
+  zat[l] = HYDRO_2D_ZA_VALUE; \
+  zbt[l] = HYDRO_2D_ZB_VALUE;
+
+#define HYDRO_2D_BODY1_FUSED_HALO \
+  zat[l] = zadat[j+k*jn]; \
+  zbt[l] = zbdat[j+k*jn];
+
+#define HYDRO_2D_BODY2_FUSED \
+  zudat[j+k*jn] += s*( zat[l] * ( zzdat[j+k*jn] - zzdat[j+1+k*jn] ) - \
+                    zat[l-1] * ( zzdat[j+k*jn] - zzdat[j-1+k*jn] ) - \
+                    zbt[l] * ( zzdat[j+k*jn] - zzdat[j+(k-1)*jn] ) + \
+                    zbt[l+ldt] * ( zzdat[j+k*jn] - zzdat[j+(k+1)*jn] ) ); \
+  zvdat[j+k*jn] += s*( zat[l] * ( zrdat[j+k*jn] - zrdat[j+1+k*jn] ) - \
+                    zat[l-1] * ( zrdat[j+k*jn] - zrdat[j-1+k*jn] ) - \
+                    zbt[l] * ( zrdat[j+k*jn] - zrdat[j+(k-1)*jn] ) + \
+                    zbt[l+ldt] * ( zrdat[j+k*jn] - zrdat[j+(k+1)*jn] ) );
+
 
 #define HYDRO_2D_VIEWS_RAJA \
   using VIEW_TYPE = RAJA::View<Real_type, RAJA::Layout<2, Index_type, 1> >; \
@@ -129,6 +175,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 class RunParams;
@@ -155,8 +203,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTiled(VariantID vid, Index_type tile_k, Index_type tile_j);
+  void runSeqVariantFused(VariantID vid, Index_type tile_k, Index_type tile_j);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid, Index_type tile_k, Index_type tile_j);
+  void runOpenMPVariantFused(VariantID vid, Index_type tile_k, Index_type tile_j);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -167,6 +223,14 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  struct TileShape
+  {
+    Index_type k;
+    Index_type j;
+  };
+
+  void addTiledTuningNames(VariantID vid);
+
   Real_ptr m_za;
   Real_ptr m_zb;
   Real_ptr m_zm;
@@ -187,6 +251,8 @@ private:
   Index_type m_kn;
 
   Index_type m_array_length;
+
+  std::vector<TileShape> m_tile_shapes;
 };
 
 } // end namespace lcals
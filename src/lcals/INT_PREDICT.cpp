@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -57,10 +59,14 @@ INT_PREDICT::~INT_PREDICT()
 {
 }
 
-void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::setUp(VariantID vid, size_t tune_idx)
 {
   m_array_length = getActualProblemSize() * 13;
   m_offset = getActualProblemSize();
+  m_block_size = getLayoutBlockSize(vid, tune_idx);
+  if (m_block_size > 0) {
+    m_array_length = getBlockedLength(getActualProblemSize(), 13, m_block_size);
+  }
 
   m_px_initval = 1.0;
   allocAndInitDataConst(m_px, m_array_length, m_px_initval, vid);
@@ -77,6 +83,18 @@ void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void INT_PREDICT::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if (m_block_size > 0) {
+
+    std::vector<Real_type> px0(getActualProblemSize());
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      px0[i] = m_px[getBlockedIndex(i, 0, 13, m_block_size)] - m_px_initval;
+    }
+
+    checksum[vid][tune_idx] += calcChecksum(px0.data(), getActualProblemSize());
+
+    return;
+  }
+
   for (Index_type i = 0; i < getActualProblemSize(); ++i) {
     m_px[i] -= m_px_initval;
   }
@@ -90,5 +108,27 @@ void INT_PREDICT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_px);
 }
 
+void INT_PREDICT::addLayoutTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "aos");
+    addVariantTuningName(vid, "soa_block_8");
+    addVariantTuningName(vid, "soa_block_16");
+  }
+}
+
+Index_type INT_PREDICT::getLayoutBlockSize(VariantID vid, size_t tune_idx) const
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  if (tuning_name == "aos") {
+    return 1;
+  } else if (tuning_name == "soa_block_8") {
+    return 8;
+  } else if (tuning_name == "soa_block_16") {
+    return 16;
+  }
+  return 0;
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
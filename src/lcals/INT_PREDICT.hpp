@@ -20,6 +20,13 @@
 ///           px[i + offset *  2];
 /// }
 ///
+/// The "aos" tuning of the Base variants stores the 13 values of each
+/// element together (interleaved), and the "soa_block_8" and
+/// "soa_block_16" tunings store blocks of 8 or 16 elements with each plane
+/// contiguous within a block (blocked SoA), see getBlockedIndex. setUp
+/// copies the data into the layout and the checksum is computed on data
+/// copied back to planar order, so checksums match the default tuning.
+///
 
 #ifndef RAJAPerf_Lcals_INT_PREDICT_HPP
 #define RAJAPerf_Lcals_INT_PREDICT_HPP
@@ -45,6 +52,14 @@
           c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
           px[i + offset *  2];
 
+#define INT_PREDICT_BODY_BLOCKED  \
+  pxb[ii] = dm28*pxb[ii + block_size * 12] + dm27*pxb[ii + block_size * 11] + \
+            dm26*pxb[ii + block_size * 10] + dm25*pxb[ii + block_size *  9] + \
+            dm24*pxb[ii + block_size *  8] + dm23*pxb[ii + block_size *  7] + \
+            dm22*pxb[ii + block_size *  6] + \
+            c0*( pxb[ii + block_size *  4] + pxb[ii + block_size *  5] ) + \
+            pxb[ii + block_size *  2];
+
 
 #include "common/KernelBase.hpp"
 
@@ -74,8 +89,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runSeqVariantBlocked(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runOpenMPVariantBlocked(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -85,8 +108,12 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addLayoutTuningNames(VariantID vid);
+  Index_type getLayoutBlockSize(VariantID vid, size_t tune_idx) const;
+
   Index_type m_array_length;
   Index_type m_offset;
+  Index_type m_block_size;
 
   Real_ptr m_px;
   Real_type m_px_initval;
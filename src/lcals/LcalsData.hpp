@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJAPerf_LcalsData_HPP
+#define RAJAPerf_LcalsData_HPP
+
+#include "common/RPTypes.hpp"
+#include "rajaperf_config.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Number of threads used by affineScanOpenMP for a loop of length n. It is
+// at least 1, so an empty loop does not request num_threads(0).
+//
+inline int getAffineScanNumThreads(Index_type n)
+{
+  return static_cast<int>(std::max(Index_type(1),
+      std::min(n, static_cast<Index_type>(omp_get_max_threads()))));
+}
+
+//
+// Solve a first-order recurrence x_i = a_i*x_{i-1} + b_i over [ibegin, iend)
+// from xinit as a scan of affine maps, as the SCAN kernel does for sums.
+// Each thread composes the maps of its chunk with map_body(i, a, b), which
+// applies step i to the map x -> a*x + b; the composed maps are combined
+// across threads, and each thread then runs chunk_body(begin, end, xin),
+// which runs the recurrence over its chunk from xin and returns the last
+// value. thread_a and thread_b hold nthreads values. Returns the value
+// after the last step.
+//
+template < typename MapBody, typename ChunkBody >
+Real_type affineScanOpenMP(Index_type ibegin, Index_type iend, Real_type xinit,
+                           int nthreads, Real_ptr thread_a, Real_ptr thread_b,
+                           MapBody&& map_body, ChunkBody&& chunk_body)
+{
+  const Index_type n = iend - ibegin;
+  Real_type xlast = xinit;
+
+  #pragma omp parallel num_threads(nthreads)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const Index_type step = n / p;
+    const Index_type local_begin = pid * step + ibegin;
+    const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+
+    Real_type xout = xinit;
+
+    if (pid == 0) {
+      xout = chunk_body(local_begin, local_end, xinit);
+      thread_b[pid] = xout;
+    } else {
+      Real_type a = 1.0;
+      Real_type b = 0.0;
+      for (Index_type i = local_begin; i < local_end; ++i ) {
+        map_body(i, a, b);
+      }
+      thread_a[pid] = a;
+      thread_b[pid] = b;
+    }
+
+    #pragma omp barrier
+
+    if (pid != 0) {
+
+      Real_type xin = thread_b[0];
+      for (int ip = 1; ip < pid; ++ip) {
+        xin = thread_a[ip] * xin + thread_b[ip];
+      }
+
+      xout = chunk_body(local_begin, local_end, xin);
+    }
+
+    if (pid == p-1) {
+      xlast = xout;
+    }
+  }
+
+  return xlast;
+}
+
+#endif
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
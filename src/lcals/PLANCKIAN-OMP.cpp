@@ -19,7 +19,7 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PLANCKIAN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -92,5 +92,92 @@ void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void PLANCKIAN::runOpenMPVariantSimd(VariantID vid, bool poly_exp)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (poly_exp) {
+          #pragma omp parallel for simd
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PLANCKIAN_BODY_POLY_EXP;
+          }
+        } else {
+          #pragma omp parallel for simd
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PLANCKIAN_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(poly_exp);
+#endif
+}
+
+void PLANCKIAN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantSimd(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantSimd(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void PLANCKIAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addSimdTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
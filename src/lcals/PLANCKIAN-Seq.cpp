@@ -19,7 +19,7 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void PLANCKIAN::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -87,5 +87,86 @@ void PLANCKIAN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void PLANCKIAN::runSeqVariantSimd(VariantID vid, bool poly_exp)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PLANCKIAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if (poly_exp) {
+          RAJAPERF_SIMD
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PLANCKIAN_BODY_POLY_EXP;
+          }
+        } else {
+          RAJAPERF_SIMD
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PLANCKIAN_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PLANCKIAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PLANCKIAN::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantSimd(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantSimd(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void PLANCKIAN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addSimdTuningNames(vid);
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
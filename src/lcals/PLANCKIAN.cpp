@@ -12,6 +12,9 @@
 
 #include "common/DataUtils.hpp"
 
+#include <cmath>
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -31,6 +34,11 @@ PLANCKIAN::PLANCKIAN(const RunParams& params)
   setBytesPerRep( (2*sizeof(Real_type ) + 3*sizeof(Real_type )) * getActualProblemSize() );
   setFLOPsPerRep(4 * getActualProblemSize()); // 1 exp
 
+  // libm exp implementations differ by an ULP or so, and the subtraction
+  // in the denominator magnifies that by e^y/(e^y-1)
+  setUlpTolerance(4.0);
+  setTuningUlpTolerance("poly_exp", 8.0);
+
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
@@ -69,6 +77,18 @@ void PLANCKIAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 void PLANCKIAN::updateChecksum(VariantID vid, size_t tune_idx)
 {
   checksum[vid][tune_idx] += calcChecksum(m_w, getActualProblemSize());
+
+  std::vector<Real_type> w_ref(getActualProblemSize());
+  for (Index_type i = 0; i < getActualProblemSize(); ++i ) {
+    w_ref[i] = m_x[i] / ( std::exp( m_u[i] / m_v[i] ) - 1.0 );
+  }
+  recordUlpError(vid, tune_idx,
+                 calcMaxUlpError(m_w, w_ref.data(), getActualProblemSize()));
+
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  if (tuning_name == "simd" || tuning_name == "poly_exp") {
+    recordUlpError(vid, tune_idx, calcSweepUlpError(tuning_name == "poly_exp"));
+  }
 }
 
 void PLANCKIAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -81,5 +101,58 @@ void PLANCKIAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
   deallocData(m_w);
 }
 
+//
+// Run the loop of the simd or poly_exp tuning over inputs with y = u/v in
+// [-700, -1] and [1, 700], which the benchmark data does not reach, and
+// return the max error in ULPs against std::exp.
+//
+long double PLANCKIAN::calcSweepUlpError(bool poly_exp) const
+{
+  const Index_type ibegin = 0;
+  const Index_type iend = s_sweep_len;
+
+  std::vector<Real_type> xv(iend, 1.0);
+  std::vector<Real_type> yv(iend);
+  std::vector<Real_type> uv(iend);
+  std::vector<Real_type> vv(iend, 1.0);
+  std::vector<Real_type> wv(iend);
+  std::vector<Real_type> w_ref(iend);
+
+  for (Index_type i = ibegin; i < iend; ++i ) {
+    Real_type y = -699.0 + 1398.0 * (i + 0.5) / iend;
+    y += (y < 0.0) ? -1.0 : 1.0;
+    uv[i] = y;
+    w_ref[i] = 1.0 / ( std::exp( y ) - 1.0 );
+  }
+
+  Real_ptr x = xv.data();
+  Real_ptr y = yv.data();
+  Real_ptr u = uv.data();
+  Real_ptr v = vv.data();
+  Real_ptr w = wv.data();
+
+  if (poly_exp) {
+    RAJAPERF_SIMD
+    for (Index_type i = ibegin; i < iend; ++i ) {
+      PLANCKIAN_BODY_POLY_EXP;
+    }
+  } else {
+    RAJAPERF_SIMD
+    for (Index_type i = ibegin; i < iend; ++i ) {
+      PLANCKIAN_BODY;
+    }
+  }
+
+  return calcMaxUlpError(w, w_ref.data(), iend);
+}
+
+void PLANCKIAN::addSimdTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "simd");
+    addVariantTuningName(vid, "poly_exp");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
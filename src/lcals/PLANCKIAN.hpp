@@ -14,6 +14,15 @@
 ///   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 /// }
 ///
+/// The "simd" tuning of the Base variants asks the compiler to vectorize
+/// the loop, so it may call a vector math library exp. The "poly_exp"
+/// tuning replaces exp with the inline polyExp approximation, which
+/// vectorizes with any compiler. The error of w against a reference
+/// computed with exp is checked in ULPs for every tuning and shown in the
+/// checksum report. For the simd and poly_exp tunings the check also runs
+/// their loop on separate inputs with y over [-700, -1] and [1, 700], so
+/// it covers exp over most of its range.
+///
 
 #ifndef RAJAPerf_Lcals_PLANCKIAN_HPP
 #define RAJAPerf_Lcals_PLANCKIAN_HPP
@@ -30,8 +39,13 @@
   y[i] = u[i] / v[i]; \
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
+#define PLANCKIAN_BODY_POLY_EXP  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( polyExp( y[i] ) - 1.0 );
+
 
 #include "common/KernelBase.hpp"
+#include "common/MathUtils.hpp"
 
 namespace rajaperf
 {
@@ -59,8 +73,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSimd(VariantID vid, bool poly_exp);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSimd(VariantID vid, bool poly_exp);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -70,6 +90,11 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addSimdTuningNames(VariantID vid);
+  long double calcSweepUlpError(bool poly_exp) const;
+
+  static const Index_type s_sweep_len = 14000;
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_u;
@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_ELIM_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "LcalsData.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void TRIDIAG_ELIM_RECUR::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  TRIDIAG_ELIM_RECUR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int p0 = getAffineScanNumThreads(iend - ibegin);
+      ::std::vector<Real_type> thread_a(p0);
+      ::std::vector<Real_type> thread_b(p0);
+
+      auto map_body = [=](Index_type i, Real_type& a, Real_type& b) {
+        TRIDIAG_ELIM_RECUR_CHUNK_MAP_BODY;
+      };
+
+      auto chunk_body = [=](Index_type begin, Index_type end, Real_type xprev) {
+        for (Index_type i = begin; i < end; ++i ) {
+          TRIDIAG_ELIM_RECUR_CHUNK_BODY;
+        }
+        return xprev;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        affineScanOpenMP(ibegin, iend, x[ibegin-1], p0,
+                         thread_a.data(), thread_b.data(),
+                         map_body, chunk_body);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,68 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_ELIM_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+TRIDIAG_ELIM_RECUR::TRIDIAG_ELIM_RECUR(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_TRIDIAG_ELIM_RECUR, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(1000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * (m_N-1) );
+  setFLOPsPerRep(2 * (getActualProblemSize()-1));
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+TRIDIAG_ELIM_RECUR::~TRIDIAG_ELIM_RECUR()
+{
+}
+
+void TRIDIAG_ELIM_RECUR::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_x, m_N, vid);
+  allocAndInitData(m_y, m_N, vid);
+  allocAndInitData(m_z, m_N, vid);
+}
+
+void TRIDIAG_ELIM_RECUR::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize());
+}
+
+void TRIDIAG_ELIM_RECUR::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_z);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRIDIAG_ELIM_RECUR kernel reference implementation:
+///
+/// Note: this is the original first-order recurrence that the TRIDIAG_ELIM
+///       kernel alters to enable parallelism.
+///
+/// for (Index_type i = 1; i < N; ++i ) {
+///   x[i] = z[i] * ( y[i] - x[i-1] );
+/// }
+///
+/// The Base_OpenMP variant solves the recurrence as a scan. Each step is
+/// the affine map x -> -z[i]*x + z[i]*y[i]; each thread composes the maps
+/// of its chunk, the composed maps are combined across threads as in the
+/// SCAN kernel, and each thread then runs the recurrence over its chunk
+/// from its incoming value.
+///
+
+#ifndef RAJAPerf_Lcals_TRIDIAG_ELIM_RECUR_HPP
+#define RAJAPerf_Lcals_TRIDIAG_ELIM_RECUR_HPP
+
+
+#define TRIDIAG_ELIM_RECUR_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z;
+
+#define TRIDIAG_ELIM_RECUR_BODY  \
+  x[i] = z[i] * ( y[i] - x[i-1] );
+
+#define TRIDIAG_ELIM_RECUR_CHUNK_BODY  \
+  xprev = z[i] * ( y[i] - xprev ); \
+  x[i] = xprev;
+
+#define TRIDIAG_ELIM_RECUR_CHUNK_MAP_BODY  \
+  a = -z[i] * a; \
+  b = z[i] * ( y[i] - b );
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class TRIDIAG_ELIM_RECUR : public KernelBase
+{
+public:
+
+  TRIDIAG_ELIM_RECUR(const RunParams& params);
+
+  ~TRIDIAG_ELIM_RECUR();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_RECUR : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_RECUR : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_ELIM_RECUR : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -18,7 +19,7 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_2MM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_2MM::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -187,5 +188,339 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void POLYBENCH_2MM::runSeqVariantTiled(VariantID vid, Index_type tile_size)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                POLYBENCH_2MM_TILE_BODY1;
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    POLYBENCH_2MM_TILE_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                POLYBENCH_2MM_TILE_BODY3;
+              }
+            }
+            for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+              const Index_type jend = std::min(jt + tile_size, nj);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type j = jt; j < jend; ++j ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    POLYBENCH_2MM_TILE_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto poly_2mm_tile_base_lam1 = [=](Index_type i, Index_type j) {
+                                        POLYBENCH_2MM_TILE_BODY1;
+                                      };
+      auto poly_2mm_tile_base_lam2 = [=](Index_type i, Index_type j,
+                                         Index_type k) {
+                                        POLYBENCH_2MM_TILE_BODY2;
+                                      };
+      auto poly_2mm_tile_base_lam3 = [=](Index_type i, Index_type l) {
+                                        POLYBENCH_2MM_TILE_BODY3;
+                                      };
+      auto poly_2mm_tile_base_lam4 = [=](Index_type i, Index_type l,
+                                         Index_type j) {
+                                        POLYBENCH_2MM_TILE_BODY4;
+                                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                poly_2mm_tile_base_lam1(i, j);
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    poly_2mm_tile_base_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                poly_2mm_tile_base_lam3(i, l);
+              }
+            }
+            for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+              const Index_type jend = std::min(jt + tile_size, nj);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type j = jt; j < jend; ++j ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    poly_2mm_tile_base_lam4(i, l, j);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_2MM_VIEWS_RAJA;
+
+      auto poly_2mm_tile_lam1 = [=](Index_type i, Index_type j) {
+                                   POLYBENCH_2MM_TILE_BODY1_RAJA;
+                                 };
+      auto poly_2mm_tile_lam2 = [=](Index_type i, Index_type j,
+                                    Index_type k) {
+                                   POLYBENCH_2MM_TILE_BODY2_RAJA;
+                                 };
+      auto poly_2mm_tile_lam3 = [=](Index_type i, Index_type l) {
+                                   POLYBENCH_2MM_TILE_BODY3_RAJA;
+                                 };
+      auto poly_2mm_tile_lam4 = [=](Index_type i, Index_type l,
+                                    Index_type j) {
+                                   POLYBENCH_2MM_TILE_BODY4_RAJA;
+                                 };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::loop_exec,
+            RAJA::statement::Tile<1, RAJA::tile_dynamic<1>, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0, RAJA::Segs<0,1>>
+                >
+              >,
+              RAJA::statement::Tile<2, RAJA::tile_dynamic<2>, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::For<2, RAJA::loop_exec,
+                    RAJA::statement::For<1, RAJA::loop_exec,
+                      RAJA::statement::Lambda<1, RAJA::Segs<0,1,2>>
+                    >
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, ni},
+                            RAJA::RangeSegment{0, nj},
+                            RAJA::RangeSegment{0, nk} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_2mm_tile_lam1,
+          poly_2mm_tile_lam2
+        );
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, ni},
+                            RAJA::RangeSegment{0, nl},
+                            RAJA::RangeSegment{0, nj} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_2mm_tile_lam3,
+          poly_2mm_tile_lam4
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_2MM::runSeqVariantPacked(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmPacked(ni, nj, nk, alpha, A, B, 0.0, tmp);
+        gemmPacked(ni, nl, nj, 1.0, tmp, C, beta, D);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_2MM::runSeqVariantLibrary(VariantID vid)
+{
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_2MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmLibrary(ni, nj, nk, alpha, A, B, 0.0, tmp);
+        gemmLibrary(ni, nl, nj, 1.0, tmp, C, beta, D);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_2MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_2MM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (Index_type tile_size : m_tile_sizes) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantTiled(vid, tile_size);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantPacked(vid);
+
+    }
+
+    t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    if (tune_idx == t) {
+
+      runSeqVariantLibrary(vid);
+
+    }
+
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_2MM::setSeqTuningDefinitions(VariantID vid)
+{
+  addGemmTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
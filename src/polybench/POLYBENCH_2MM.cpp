@@ -39,6 +39,8 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
   m_alpha = 1.5;
   m_beta = 1.2;
 
+  m_tile_sizes = getGemmTileSizes(run_params);
+
 
   setActualProblemSize( std::max( m_ni*m_nj, m_ni*m_nl ) );
 
@@ -84,6 +86,22 @@ POLYBENCH_2MM::~POLYBENCH_2MM()
 {
 }
 
+void POLYBENCH_2MM::addGemmTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  for (Index_type tile_size : m_tile_sizes) {
+    addVariantTuningName(vid, getGemmTileName(tile_size));
+  }
+
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "packed");
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    addVariantTuningName(vid, "library");
+#endif
+  }
+}
+
 void POLYBENCH_2MM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
@@ -30,6 +30,12 @@
 ///   }
 /// }
 ///
+/// The tiled tunings ("tile_<n>", see --gemm_tile_size) block both matrix
+/// products with n x n tiles and accumulate directly into tmp and D. The
+/// "packed" and "library" tunings compute each product with the packed
+/// micro-kernel or the system BLAS (see PolybenchData.hpp), as in
+/// POLYBENCH_GEMM.
+///
 
 
 #ifndef RAJAPerf_POLYBENCH_2MM_HPP
@@ -70,6 +76,19 @@
   D[l + i*nl] = dot;
 
 
+#define POLYBENCH_2MM_TILE_BODY1 \
+  tmp[j + i*nj] = 0.0;
+
+#define POLYBENCH_2MM_TILE_BODY2 \
+  tmp[j + i*nj] += alpha * A[k + i*nk] * B[j + k*nj];
+
+#define POLYBENCH_2MM_TILE_BODY3 \
+  D[l + i*nl] = beta;
+
+#define POLYBENCH_2MM_TILE_BODY4 \
+  D[l + i*nl] += tmp[j + i*nj] * C[l + j*nl];
+
+
 #define POLYBENCH_2MM_BODY1_RAJA \
   dot = 0.0;
 
@@ -89,6 +108,19 @@
   Dview(i,l) = dot;
 
 
+#define POLYBENCH_2MM_TILE_BODY1_RAJA \
+  tmpview(i,j) = 0.0;
+
+#define POLYBENCH_2MM_TILE_BODY2_RAJA \
+  tmpview(i,j) += alpha * Aview(i,k) * Bview(k,j);
+
+#define POLYBENCH_2MM_TILE_BODY3_RAJA \
+  Dview(i,l) = beta;
+
+#define POLYBENCH_2MM_TILE_BODY4_RAJA \
+  Dview(i,l) += tmpview(i,j) * Cview(j,l);
+
+
 #define POLYBENCH_2MM_VIEWS_RAJA \
 using VIEW_TYPE = RAJA::View<Real_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
@@ -101,6 +133,9 @@ using VIEW_TYPE = RAJA::View<Real_type, \
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -128,8 +163,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTiled(VariantID vid, Index_type tile_size);
+  void runSeqVariantPacked(VariantID vid);
+  void runSeqVariantLibrary(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid, Index_type tile_size);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -140,6 +185,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addGemmTuningNames(VariantID vid);
+
+  std::vector<Index_type> m_tile_sizes;
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
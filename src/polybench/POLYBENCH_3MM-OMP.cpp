@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <cstring>
 
@@ -27,7 +28,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_3MM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -295,5 +296,427 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_3MM::runOpenMPVariantTiled(VariantID vid, Index_type tile_size)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                POLYBENCH_3MM_TILE_BODY1;
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    POLYBENCH_3MM_TILE_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type jend = std::min(jt + tile_size, nj);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type j = jt; j < jend; ++j ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                POLYBENCH_3MM_TILE_BODY3;
+              }
+            }
+            for (Index_type mt = 0; mt < nm; mt += tile_size ) {
+              const Index_type mend = std::min(mt + tile_size, nm);
+              for (Index_type j = jt; j < jend; ++j ) {
+                for (Index_type m = mt; m < mend; ++m ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    POLYBENCH_3MM_TILE_BODY4;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                POLYBENCH_3MM_TILE_BODY5;
+              }
+            }
+            for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+              const Index_type jend = std::min(jt + tile_size, nj);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type j = jt; j < jend; ++j ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    POLYBENCH_3MM_TILE_BODY6;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_3mm_tile_base_lam1 = [=](Index_type i, Index_type j) {
+                                        POLYBENCH_3MM_TILE_BODY1;
+                                      };
+      auto poly_3mm_tile_base_lam2 = [=](Index_type i, Index_type j,
+                                         Index_type k) {
+                                        POLYBENCH_3MM_TILE_BODY2;
+                                      };
+      auto poly_3mm_tile_base_lam3 = [=](Index_type j, Index_type l) {
+                                        POLYBENCH_3MM_TILE_BODY3;
+                                      };
+      auto poly_3mm_tile_base_lam4 = [=](Index_type j, Index_type l,
+                                         Index_type m) {
+                                        POLYBENCH_3MM_TILE_BODY4;
+                                      };
+      auto poly_3mm_tile_base_lam5 = [=](Index_type i, Index_type l) {
+                                        POLYBENCH_3MM_TILE_BODY5;
+                                      };
+      auto poly_3mm_tile_base_lam6 = [=](Index_type i, Index_type l,
+                                         Index_type j) {
+                                        POLYBENCH_3MM_TILE_BODY6;
+                                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                poly_3mm_tile_base_lam1(i, j);
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    poly_3mm_tile_base_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type jend = std::min(jt + tile_size, nj);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type j = jt; j < jend; ++j ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                poly_3mm_tile_base_lam3(j, l);
+              }
+            }
+            for (Index_type mt = 0; mt < nm; mt += tile_size ) {
+              const Index_type mend = std::min(mt + tile_size, nm);
+              for (Index_type j = jt; j < jend; ++j ) {
+                for (Index_type m = mt; m < mend; ++m ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    poly_3mm_tile_base_lam4(j, l, m);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type lt = 0; lt < nl; lt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type lend = std::min(lt + tile_size, nl);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type l = lt; l < lend; ++l ) {
+                poly_3mm_tile_base_lam5(i, l);
+              }
+            }
+            for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+              const Index_type jend = std::min(jt + tile_size, nj);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type j = jt; j < jend; ++j ) {
+                  for (Index_type l = lt; l < lend; ++l ) {
+                    poly_3mm_tile_base_lam6(i, l, j);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_3MM_VIEWS_RAJA;
+
+      auto poly_3mm_tile_lam1 = [=](Index_type i, Index_type j) {
+                                   POLYBENCH_3MM_TILE_BODY1_RAJA;
+                                 };
+      auto poly_3mm_tile_lam2 = [=](Index_type i, Index_type j,
+                                    Index_type k) {
+                                   POLYBENCH_3MM_TILE_BODY2_RAJA;
+                                 };
+      auto poly_3mm_tile_lam3 = [=](Index_type j, Index_type l) {
+                                   POLYBENCH_3MM_TILE_BODY3_RAJA;
+                                 };
+      auto poly_3mm_tile_lam4 = [=](Index_type j, Index_type l,
+                                    Index_type m) {
+                                   POLYBENCH_3MM_TILE_BODY4_RAJA;
+                                 };
+      auto poly_3mm_tile_lam5 = [=](Index_type i, Index_type l) {
+                                   POLYBENCH_3MM_TILE_BODY5_RAJA;
+                                 };
+      auto poly_3mm_tile_lam6 = [=](Index_type i, Index_type l,
+                                    Index_type j) {
+                                   POLYBENCH_3MM_TILE_BODY6_RAJA;
+                                 };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<1, RAJA::tile_dynamic<1>, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0, RAJA::Segs<0,1>>
+                >
+              >,
+              RAJA::statement::Tile<2, RAJA::tile_dynamic<2>, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::For<2, RAJA::loop_exec,
+                    RAJA::statement::For<1, RAJA::loop_exec,
+                      RAJA::statement::Lambda<1, RAJA::Segs<0,1,2>>
+                    >
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, ni},
+                            RAJA::RangeSegment{0, nj},
+                            RAJA::RangeSegment{0, nk} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_3mm_tile_lam1,
+          poly_3mm_tile_lam2
+        );
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, nj},
+                            RAJA::RangeSegment{0, nl},
+                            RAJA::RangeSegment{0, nm} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_3mm_tile_lam3,
+          poly_3mm_tile_lam4
+        );
+
+        RAJA::kernel_param<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, ni},
+                            RAJA::RangeSegment{0, nl},
+                            RAJA::RangeSegment{0, nj} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_3mm_tile_lam5,
+          poly_3mm_tile_lam6
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_3MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile_size);
+#endif
+}
+
+void POLYBENCH_3MM::runOpenMPVariantPacked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmPackedOpenMP(ni, nj, nk, 1.0, A, B, 0.0, E);
+        gemmPackedOpenMP(nj, nl, nm, 1.0, C, D, 0.0, F);
+        gemmPackedOpenMP(ni, nl, nj, 1.0, E, F, 0.0, G);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_3MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_3MM::runOpenMPVariantLibrary(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJA_PERFSUITE_ENABLE_BLAS)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_3MM_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmLibrary(ni, nj, nk, 1.0, A, B, 0.0, E);
+        gemmLibrary(nj, nl, nm, 1.0, C, D, 0.0, F);
+        gemmLibrary(ni, nl, nj, 1.0, E, F, 0.0, G);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_3MM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_3MM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (Index_type tile_size : m_tile_sizes) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTiled(vid, tile_size);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPacked(vid);
+
+    }
+
+    t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    if (tune_idx == t) {
+
+      runOpenMPVariantLibrary(vid);
+
+    }
+
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_3MM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addGemmTuningNames(vid);
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -41,6 +41,8 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
   m_nl = m_ni;
   m_nm = nm_default;
 
+  m_tile_sizes = getGemmTileSizes(run_params);
+
 
   setActualProblemSize( std::max( std::max( m_ni*m_nj, m_nj*m_nl ),
                                   m_ni*m_nl ) );
@@ -92,6 +94,22 @@ POLYBENCH_3MM::~POLYBENCH_3MM()
 {
 }
 
+void POLYBENCH_3MM::addGemmTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  for (Index_type tile_size : m_tile_sizes) {
+    addVariantTuningName(vid, getGemmTileName(tile_size));
+  }
+
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "packed");
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    addVariantTuningName(vid, "library");
+#endif
+  }
+}
+
 void POLYBENCH_3MM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
@@ -38,6 +38,12 @@
 ///   }
 /// }
 ///
+/// The tiled tunings ("tile_<n>", see --gemm_tile_size) block all three
+/// matrix products with n x n tiles and accumulate directly into E, F, and
+/// G. The "packed" and "library" tunings compute each product with the
+/// packed micro-kernel or the system BLAS (see PolybenchData.hpp), as in
+/// POLYBENCH_GEMM.
+///
 
 #ifndef RAJAPerf_POLYBENCH_3MM_HPP
 #define RAJAPerf_POLYBENCH_3MM_HPP
@@ -86,6 +92,25 @@
   G[l + i*nl] = dot;
 
 
+#define POLYBENCH_3MM_TILE_BODY1 \
+  E[j + i*nj] = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY2 \
+  E[j + i*nj] += A[k + i*nk] * B[j + k*nj];
+
+#define POLYBENCH_3MM_TILE_BODY3 \
+  F[l + j*nl] = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY4 \
+  F[l + j*nl] += C[m + j*nm] * D[l + m*nl];
+
+#define POLYBENCH_3MM_TILE_BODY5 \
+  G[l + i*nl] = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY6 \
+  G[l + i*nl] += E[j + i*nj] * F[l + j*nl];
+
+
 #define POLYBENCH_3MM_BODY1_RAJA \
   dot = 0.0;
 
@@ -114,6 +139,25 @@
   Gview(i,l) = dot;
 
 
+#define POLYBENCH_3MM_TILE_BODY1_RAJA \
+  Eview(i,j) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY2_RAJA \
+  Eview(i,j) += Aview(i,k) * Bview(k,j);
+
+#define POLYBENCH_3MM_TILE_BODY3_RAJA \
+  Fview(j,l) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY4_RAJA \
+  Fview(j,l) += Cview(j,m) * Dview(m,l);
+
+#define POLYBENCH_3MM_TILE_BODY5_RAJA \
+  Gview(i,l) = 0.0;
+
+#define POLYBENCH_3MM_TILE_BODY6_RAJA \
+  Gview(i,l) += Eview(i,j) * Fview(j,l);
+
+
 #define POLYBENCH_3MM_VIEWS_RAJA \
 using VIEW_TYPE = RAJA::View<Real_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
@@ -127,6 +171,9 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE Gview(G, RAJA::Layout<2>(ni, nl));
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -154,8 +201,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTiled(VariantID vid, Index_type tile_size);
+  void runSeqVariantPacked(VariantID vid);
+  void runSeqVariantLibrary(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid, Index_type tile_size);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -166,6 +223,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addGemmTuningNames(VariantID vid);
+
+  std::vector<Index_type> m_tile_sizes;
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <cstring>
 
 namespace rajaperf
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -223,5 +225,227 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void POLYBENCH_ADI::runOpenMPVariantBatched(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type nl = lane_batch_size;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          std::vector<Real_type> scratch((nl+2)*n + 3*nl*n);
+          Real_ptr Vb = scratch.data();
+          Real_ptr Pb = Vb + (nl+2)*n;
+          Real_ptr Qb = Pb + nl*n;
+          Real_ptr Ub = Qb + nl*n;
+
+          for (Index_type t = 1; t <= tsteps; ++t) {
+
+            // column sweep, nl lines per chunk
+            #pragma omp for
+            for (Index_type i0 = 1; i0 < n-1; i0 += nl) {
+              const Index_type i1 = std::min(i0 + nl, n-1);
+
+              for (Index_type i = i0; i < i1; ++i) {
+                POLYBENCH_ADI_BODY2_BATCHED;
+              }
+              for (Index_type j = 1; j < n-1; ++j) {
+                for (Index_type i = i0; i < i1; ++i) {
+                  POLYBENCH_ADI_BODY3_BATCHED;
+                }
+              }
+              for (Index_type i = i0; i < i1; ++i) {
+                POLYBENCH_ADI_BODY4;
+              }
+              for (Index_type k = n-2; k >= 1; --k) {
+                for (Index_type i = i0; i < i1; ++i) {
+                  POLYBENCH_ADI_BODY5_BATCHED;
+                }
+              }
+            }
+
+            // row sweep, nl lines at a time in interleaved scratch
+            #pragma omp for
+            for (Index_type i0 = 1; i0 < n-1; i0 += nl) {
+              const Index_type nb = std::min(nl, n-1 - i0);
+
+              POLYBENCH_ADI_BATCH_GATHER;
+              for (Index_type l = 0; l < nb; ++l) {
+                POLYBENCH_ADI_BODY6_BATCHED;
+              }
+              for (Index_type j = 1; j < n-1; ++j) {
+                for (Index_type l = 0; l < nb; ++l) {
+                  POLYBENCH_ADI_BODY7_BATCHED;
+                }
+              }
+              for (Index_type l = 0; l < nb; ++l) {
+                POLYBENCH_ADI_BODY8_BATCHED;
+              }
+              for (Index_type k = n-2; k >= 1; --k) {
+                for (Index_type l = 0; l < nb; ++l) {
+                  POLYBENCH_ADI_BODY9_BATCHED;
+                }
+              }
+              POLYBENCH_ADI_BATCH_SCATTER;
+            }
+
+          }  // tstep loop
+
+        }
+
+      }  // run_reps
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\nPOLYBENCH_ADI  Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ADI::runOpenMPVariantTranspose(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const Index_type tb = lane_batch_size;
+
+      std::vector<Real_type> scratch(2*n*n);
+      Real_ptr Ut = scratch.data();
+      Real_ptr Vt = Ut + n*n;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          for (Index_type t = 1; t <= tsteps; ++t) {
+
+            // column sweep on rows of the transpose of U
+            #pragma omp for
+            for (Index_type ib = 0; ib < n; ib += tb) {
+              for (Index_type jb = 0; jb < n; jb += tb) {
+                POLYBENCH_ADI_TRANSPOSE_BLOCK(Ut, U, ib, std::min(ib+tb, n),
+                                              jb, std::min(jb+tb, n));
+              }
+            }
+            #pragma omp for
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY2_TRANSPOSE;
+              for (Index_type j = 1; j < n-1; ++j) {
+                POLYBENCH_ADI_BODY3_TRANSPOSE;
+              }
+              POLYBENCH_ADI_BODY4_TRANSPOSE;
+              for (Index_type k = n-2; k >= 1; --k) {
+                POLYBENCH_ADI_BODY5_TRANSPOSE;
+              }
+            }
+            #pragma omp for
+            for (Index_type ib = 0; ib < n; ib += tb) {
+              for (Index_type jb = 1; jb < n-1; jb += tb) {
+                POLYBENCH_ADI_TRANSPOSE_BLOCK(V, Vt, ib, std::min(ib+tb, n),
+                                              jb, std::min(jb+tb, n-1));
+              }
+            }
+
+            #pragma omp for
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY6;
+              for (Index_type j = 1; j < n-1; ++j) {
+                POLYBENCH_ADI_BODY7;
+              }
+              POLYBENCH_ADI_BODY8;
+              for (Index_type k = n-2; k >= 1; --k) {
+                POLYBENCH_ADI_BODY9;
+              }
+            }
+
+          }  // tstep loop
+
+        }
+
+      }  // run_reps
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\nPOLYBENCH_ADI  Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_ADI::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBatched(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTranspose(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_ADI::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBatchedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
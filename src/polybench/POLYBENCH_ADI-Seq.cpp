@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <cstring>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ADI::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -215,5 +217,198 @@ void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void POLYBENCH_ADI::runSeqVariantBatched(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      const Index_type nl = lane_batch_size;
+
+      std::vector<Real_type> scratch((nl+2)*n + 3*nl*n);
+      Real_ptr Vb = scratch.data();
+      Real_ptr Pb = Vb + (nl+2)*n;
+      Real_ptr Qb = Pb + nl*n;
+      Real_ptr Ub = Qb + nl*n;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          // column sweep, all lines at once
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2_BATCHED;
+          }
+          for (Index_type j = 1; j < n-1; ++j) {
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY3_BATCHED;
+            }
+          }
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY4;
+          }
+          for (Index_type k = n-2; k >= 1; --k) {
+            for (Index_type i = 1; i < n-1; ++i) {
+              POLYBENCH_ADI_BODY5_BATCHED;
+            }
+          }
+
+          // row sweep, nl lines at a time in interleaved scratch
+          for (Index_type i0 = 1; i0 < n-1; i0 += nl) {
+            const Index_type nb = std::min(nl, n-1 - i0);
+
+            POLYBENCH_ADI_BATCH_GATHER;
+            for (Index_type l = 0; l < nb; ++l) {
+              POLYBENCH_ADI_BODY6_BATCHED;
+            }
+            for (Index_type j = 1; j < n-1; ++j) {
+              for (Index_type l = 0; l < nb; ++l) {
+                POLYBENCH_ADI_BODY7_BATCHED;
+              }
+            }
+            for (Index_type l = 0; l < nb; ++l) {
+              POLYBENCH_ADI_BODY8_BATCHED;
+            }
+            for (Index_type k = n-2; k >= 1; --k) {
+              for (Index_type l = 0; l < nb; ++l) {
+                POLYBENCH_ADI_BODY9_BATCHED;
+              }
+            }
+            POLYBENCH_ADI_BATCH_SCATTER;
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\nPOLYBENCH_ADI  Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ADI::runSeqVariantTranspose(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ADI_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      const Index_type tb = lane_batch_size;
+
+      std::vector<Real_type> scratch(2*n*n);
+      Real_ptr Ut = scratch.data();
+      Real_ptr Vt = Ut + n*n;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 1; t <= tsteps; ++t) {
+
+          // column sweep on rows of the transpose of U
+          for (Index_type ib = 0; ib < n; ib += tb) {
+            for (Index_type jb = 0; jb < n; jb += tb) {
+              POLYBENCH_ADI_TRANSPOSE_BLOCK(Ut, U, ib, std::min(ib+tb, n),
+                                            jb, std::min(jb+tb, n));
+            }
+          }
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY2_TRANSPOSE;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY3_TRANSPOSE;
+            }
+            POLYBENCH_ADI_BODY4_TRANSPOSE;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY5_TRANSPOSE;
+            }
+          }
+          for (Index_type ib = 0; ib < n; ib += tb) {
+            for (Index_type jb = 1; jb < n-1; jb += tb) {
+              POLYBENCH_ADI_TRANSPOSE_BLOCK(V, Vt, ib, std::min(ib+tb, n),
+                                            jb, std::min(jb+tb, n-1));
+            }
+          }
+
+          for (Index_type i = 1; i < n-1; ++i) {
+            POLYBENCH_ADI_BODY6;
+            for (Index_type j = 1; j < n-1; ++j) {
+              POLYBENCH_ADI_BODY7;
+            }
+            POLYBENCH_ADI_BODY8;
+            for (Index_type k = n-2; k >= 1; --k) {
+              POLYBENCH_ADI_BODY9;
+            }
+          }
+
+        }  // tstep loop
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\nPOLYBENCH_ADI  Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ADI::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantBatched(vid);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantTranspose(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_ADI::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBatchedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -91,5 +91,13 @@ void POLYBENCH_ADI::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   deallocData(m_Q);
 }
 
+void POLYBENCH_ADI::addBatchedTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "batched");
+    addVariantTuningName(vid, "transpose");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -57,7 +57,21 @@
 ///      }
 ///    }
 ///  }
-
+///
+/// The Base variants have two more tunings that solve the same tridiagonal
+/// systems with contiguous accesses across lines:
+///
+/// "batched" solves many lines at once with one line per SIMD lane. In the
+/// column sweep lines run along i, so P and Q are stored transposed
+/// (P[j][i], Q[j][i]) and the inner loops over i are unit stride. In the
+/// row sweep, batches of lines are copied into interleaved scratch arrays
+/// (element j of lane l at [j][l]), solved, and copied back to U.
+///
+/// "transpose" transposes U before the column sweep, runs it on rows like
+/// the row sweep, and transposes the result back into V.
+///
+/// Both tunings do the same arithmetic per element as the default tuning,
+/// so the checksums of U match exactly.
 
 
 #ifndef RAJAPerf_POLYBENCH_ADI_HPP
@@ -123,6 +137,77 @@
   U[i * n + k] = P[i * n + k] * U[i * n + k +1] + Q[i * n + k];
 
 
+#define POLYBENCH_ADI_BODY2_BATCHED \
+  V[0 * n + i] = 1.0; \
+  P[0 * n + i] = 0.0; \
+  Q[0 * n + i] = V[0 * n + i];
+
+#define POLYBENCH_ADI_BODY3_BATCHED \
+  P[j * n + i] = -c / (a * P[(j-1) * n + i] + b); \
+  Q[j * n + i] = (-d * U[j * n + i-1] + (1.0 + 2.0*d) * U[j * n + i] - \
+                 f * U[j * n + i + 1] - a * Q[(j-1) * n + i]) / \
+                    (a * P[(j-1) * n + i] + b);
+
+#define POLYBENCH_ADI_BODY5_BATCHED \
+  V[k * n + i]  = P[k * n + i] * V[(k+1) * n + i] + Q[k * n + i];
+
+#define POLYBENCH_ADI_BODY6_BATCHED \
+  Ub[0 * nl + l] = 1.0; \
+  Pb[0 * nl + l] = 0.0; \
+  Qb[0 * nl + l] = Ub[0 * nl + l];
+
+#define POLYBENCH_ADI_BODY7_BATCHED \
+  Pb[j * nl + l] = -f / (d * Pb[(j-1) * nl + l] + e); \
+  Qb[j * nl + l] = (-a * Vb[j * (nl+2) + l] + (1.0 + 2.0*a) * Vb[j * (nl+2) + l+1] - \
+                   c * Vb[j * (nl+2) + l+2] - d * Qb[(j-1) * nl + l]) / \
+                      (d * Pb[(j-1) * nl + l] + e);
+
+#define POLYBENCH_ADI_BODY8_BATCHED \
+  Ub[(n-1) * nl + l] = 1.0;
+
+#define POLYBENCH_ADI_BODY9_BATCHED \
+  Ub[k * nl + l] = Pb[k * nl + l] * Ub[(k+1) * nl + l] + Qb[k * nl + l];
+
+#define POLYBENCH_ADI_BATCH_GATHER \
+  for (Index_type j = 0; j < n; ++j) { \
+    for (Index_type l = 0; l < nb+2; ++l) { \
+      Vb[j * (nl+2) + l] = V[(i0-1+l) * n + j]; \
+    } \
+  }
+
+#define POLYBENCH_ADI_BATCH_SCATTER \
+  for (Index_type l = 0; l < nb; ++l) { \
+    for (Index_type k = 0; k < n; ++k) { \
+      U[(i0+l) * n + k] = Ub[k * nl + l]; \
+    } \
+  }
+
+
+#define POLYBENCH_ADI_BODY2_TRANSPOSE \
+  Vt[i * n + 0] = 1.0; \
+  P[i * n + 0] = 0.0; \
+  Q[i * n + 0] = Vt[i * n + 0];
+
+#define POLYBENCH_ADI_BODY3_TRANSPOSE \
+  P[i * n + j] = -c / (a * P[i * n + j-1] + b); \
+  Q[i * n + j] = (-d * Ut[(i-1) * n + j] + (1.0 + 2.0*d) * Ut[i * n + j] - \
+                 f * Ut[(i+1) * n + j] - a * Q[i * n + j-1]) / \
+                    (a * P[i * n + j-1] + b);
+
+#define POLYBENCH_ADI_BODY4_TRANSPOSE \
+  Vt[i * n + n-1] = 1.0;
+
+#define POLYBENCH_ADI_BODY5_TRANSPOSE \
+  Vt[i * n + k] = P[i * n + k] * Vt[i * n + k+1] + Q[i * n + k];
+
+#define POLYBENCH_ADI_TRANSPOSE_BLOCK(dst, src, i0, i1, j0, j1) \
+  for (Index_type i = i0; i < i1; ++i) { \
+    for (Index_type j = j0; j < j1; ++j) { \
+      dst[i * n + j] = src[j * n + i]; \
+    } \
+  }
+
+
 #define POLYBENCH_ADI_BODY2_RAJA \
   Vview(0, i) = 1.0; \
   Pview(i, 0) = 0.0; \
@@ -196,8 +281,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBatched(VariantID vid);
+  void runSeqVariantTranspose(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBatched(VariantID vid);
+  void runOpenMPVariantTranspose(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -207,6 +300,12 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // lines per batch or chunk in the batched tuning, and block size of the
+  // transposes in the transpose tuning
+  static const Index_type lane_batch_size = 16;
+
+  void addBatchedTuningNames(VariantID vid);
+
   Index_type m_n;
   Index_type m_tsteps;
 
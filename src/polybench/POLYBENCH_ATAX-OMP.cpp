@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 
 namespace rajaperf
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -191,5 +193,139 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void POLYBENCH_ATAX::runOpenMPVariantFused(VariantID vid, bool blocked)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      const int p0 = omp_get_max_threads();
+      std::vector<Real_type> accs(p0 * N);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel num_threads(p0)
+        {
+          const int p = omp_get_num_threads();
+          Real_ptr acc = accs.data() + omp_get_thread_num() * N;
+
+          for (Index_type i = 0; i < N; ++i ) {
+            acc[i] = 0.0;
+          }
+
+          if (blocked) {
+
+            #pragma omp for schedule(static)
+            for (Index_type i0 = 0; i0 < N; i0 += matvec_block_rows) {
+              const Index_type i1 = std::min(i0 + matvec_block_rows, N);
+              for (Index_type i = i0; i < i1; ++i ) {
+                POLYBENCH_ATAX_BODY1_FUSED;
+                for (Index_type j = 0; j < N; ++j ) {
+                  POLYBENCH_ATAX_BODY2;
+                }
+                POLYBENCH_ATAX_BODY3;
+              }
+              for (Index_type j0 = 0; j0 < N; j0 += matvec_chunk_cols) {
+                const Index_type j1 = std::min(j0 + matvec_chunk_cols, N);
+                for (Index_type i = i0; i < i1; ++i ) {
+                  for (Index_type j = j0; j < j1; ++j ) {
+                    POLYBENCH_ATAX_BODY5_FUSED;
+                  }
+                }
+              }
+            }
+
+          } else {
+
+            #pragma omp for schedule(static)
+            for (Index_type i = 0; i < N; ++i ) {
+              POLYBENCH_ATAX_BODY1_FUSED;
+              for (Index_type j = 0; j < N; ++j ) {
+                POLYBENCH_ATAX_BODY2;
+              }
+              POLYBENCH_ATAX_BODY3;
+              for (Index_type j = 0; j < N; ++j ) {
+                POLYBENCH_ATAX_BODY5_FUSED;
+              }
+            }
+
+          }
+
+          #pragma omp for schedule(static)
+          for (Index_type i = 0; i < N; ++i ) {
+            Real_type sum = 0.0;
+            for (int t = 0; t < p; ++t) {
+              sum += accs[i + t*N];
+            }
+            POLYBENCH_ATAX_BODY6_FUSED;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(blocked);
+#endif
+}
+
+void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantFused(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantFused(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_ATAX::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addFusedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_ATAX::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -185,5 +187,120 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
 }
 
+void POLYBENCH_ATAX::runSeqVariantFused(VariantID vid, bool blocked)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_ATAX_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      std::vector<Real_type> accs(N);
+      Real_ptr acc = accs.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          acc[i] = 0.0;
+        }
+
+        if (blocked) {
+
+          for (Index_type i0 = 0; i0 < N; i0 += matvec_block_rows) {
+            const Index_type i1 = std::min(i0 + matvec_block_rows, N);
+            for (Index_type i = i0; i < i1; ++i ) {
+              POLYBENCH_ATAX_BODY1_FUSED;
+              for (Index_type j = 0; j < N; ++j ) {
+                POLYBENCH_ATAX_BODY2;
+              }
+              POLYBENCH_ATAX_BODY3;
+            }
+            for (Index_type j0 = 0; j0 < N; j0 += matvec_chunk_cols) {
+              const Index_type j1 = std::min(j0 + matvec_chunk_cols, N);
+              for (Index_type i = i0; i < i1; ++i ) {
+                for (Index_type j = j0; j < j1; ++j ) {
+                  POLYBENCH_ATAX_BODY5_FUSED;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_ATAX_BODY1_FUSED;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_ATAX_BODY2;
+            }
+            POLYBENCH_ATAX_BODY3;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_ATAX_BODY5_FUSED;
+            }
+          }
+
+        }
+
+        for (Index_type i = 0; i < N; ++i ) {
+          Real_type sum = acc[i];
+          POLYBENCH_ATAX_BODY6_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_ATAX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_ATAX::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_ATAX::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addFusedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
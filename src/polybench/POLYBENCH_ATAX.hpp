@@ -21,6 +21,14 @@
 ///     y[j] += A[i][j] * tmp[i];
 ///   }
 /// }
+///
+/// The "fused" and "blocked" tunings of the Base variants compute both
+/// products in one pass over A. Each row of A is used for tmp[i] and, while
+/// still in cache, for its contribution to y; OpenMP threads accumulate
+/// their rows' contributions to y in private arrays that are summed at the
+/// end. The "blocked" tuning handles blocks of rows and updates y in chunks
+/// that stay in cache across the rows of a block. Sequential checksums
+/// match the default tuning; OpenMP ones may differ by rounding.
 
 
 #ifndef RAJAPerf_POLYBENCH_ATAX_HPP
@@ -54,6 +62,15 @@
 #define POLYBENCH_ATAX_BODY6 \
   y[j] = dot;
 
+#define POLYBENCH_ATAX_BODY1_FUSED \
+  Real_type dot = 0.0;
+
+#define POLYBENCH_ATAX_BODY5_FUSED \
+  acc[j] += A[j + i*N] * tmp[i];
+
+#define POLYBENCH_ATAX_BODY6_FUSED \
+  y[i] = sum;
+
 
 #define POLYBENCH_ATAX_BODY1_RAJA \
   yview(i) = 0.0; \
@@ -89,6 +106,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
 
 namespace rajaperf
 {
@@ -116,8 +134,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid, bool blocked);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid, bool blocked);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -127,6 +151,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addFusedTuningNames(VariantID vid);
+
   Index_type m_N;
   Real_ptr m_tmp;
   Real_ptr m_y;
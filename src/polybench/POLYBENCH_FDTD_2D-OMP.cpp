@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_FDTD_2D::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -201,5 +202,125 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+void POLYBENCH_FDTD_2D::runOpenMPVariantTimeTiled(VariantID vid,
+                                                  const TimeTile& tile)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_FDTD_2D_DATA_SETUP;
+
+  // enough tiles for the last one to reach row nx - 1 when shifted by
+  // the last time step of a block
+  const Index_type ntiles = (nx + tile.time - 1 + tile.space - 1) / tile.space;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel private(t)
+        {
+
+          for (Index_type tt = 0; tt < tsteps; tt += tile.time) {
+            const Index_type nt = std::min(tile.time, tsteps - tt);
+
+            for (Index_type it = 0; it < ntiles; ++it) {
+              for (Index_type s = 0; s < nt; ++s) {
+
+                t = tt + s;
+
+                const Index_type lo = it*tile.space - s;
+                const Index_type ibegin = std::max(lo, Index_type(0));
+                const Index_type iend = std::min(lo + tile.space, nx);
+                const Index_type hbegin = std::max(lo - 1, Index_type(0));
+                const Index_type hend = std::min(lo + tile.space - 1, nx - 1);
+
+                #pragma omp for
+                for (Index_type i = ibegin; i < iend; i++) {
+                  if (i == 0) {
+                    for (Index_type j = 0; j < ny; j++) {
+                      POLYBENCH_FDTD_2D_BODY1;
+                    }
+                  } else {
+                    for (Index_type j = 0; j < ny; j++) {
+                      POLYBENCH_FDTD_2D_BODY2;
+                    }
+                  }
+                  for (Index_type j = 1; j < ny; j++) {
+                    POLYBENCH_FDTD_2D_BODY3;
+                  }
+                }
+                #pragma omp for
+                for (Index_type i = hbegin; i < hend; i++) {
+                  for (Index_type j = 0; j < ny - 1; j++) {
+                    POLYBENCH_FDTD_2D_BODY4;
+                  }
+                }
+
+              }
+            }
+
+          }  // tstep loop
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FDTD_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile);
+#endif
+}
+
+void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    for (const TimeTile& tile : m_time_tiles) {
+
+      if (tune_idx == t) {
+
+        runOpenMPVariantTimeTiled(vid, tile);
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void POLYBENCH_FDTD_2D::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addTimeTileTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -35,6 +35,8 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
   m_ny = m_nx;
   m_tsteps = 40;
 
+  m_time_tiles = {{16, 4}, {32, 8}};
+
 
   setActualProblemSize( std::max( (m_nx-1)*m_ny, m_nx*(m_ny-1) ) );
 
@@ -112,5 +114,14 @@ void POLYBENCH_FDTD_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   deallocData(m_hz);
 }
 
+void POLYBENCH_FDTD_2D::addTimeTileTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    for (const TimeTile& tile : m_time_tiles) {
+      addVariantTuningName(vid, getTimeTileName(tile));
+    }
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -31,6 +31,15 @@
 ///     }
 ///   }
 /// }
+///
+/// The "time_tile_<s>x<t>" tunings of the Base variants apply skewed
+/// tiling over the time loop. Rows are cut into tiles of s rows, and each
+/// tile is advanced through a block of t time steps before the next tile
+/// starts, with its rows shifted down by one per time step. Rows of hz are
+/// updated one row behind the ey and ex rows of the same tile, so each
+/// update reads the same values as in the reference loops and the checksums
+/// match the default tuning exactly. Tiles run in order; the OpenMP
+/// tuning divides the rows of each tile and time step between threads.
 
 
 #ifndef RAJAPerf_POLYBENCH_FDTD_2D_HPP
@@ -87,6 +96,9 @@ using VIEW_TYPE = RAJA::View<Real_type, \
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -114,8 +126,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTimeTiled(VariantID vid, const TimeTile& tile);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTimeTiled(VariantID vid, const TimeTile& tile);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -126,6 +144,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addTimeTileTuningNames(VariantID vid);
+
+  std::vector<TimeTile> m_time_tiles;
+
   Index_type m_nx;
   Index_type m_ny;
   Index_type m_tsteps;
@@ -0,0 +1,174 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_IN_PLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_IN_PLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          // row k and column k are not changed in step k, so rows may be
+          // updated concurrently within one parallel region
+          for (Index_type k = 0; k < N; ++k) {
+            #pragma omp for
+            for (Index_type i = 0; i < N; ++i) {
+              for (Index_type j = 0; j < N; ++j) {
+                POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BODY;
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runOpenMPVariantBlocked(VariantID vid,
+                                                                Index_type tile_size)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_IN_PLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          for (Index_type kt = 0; kt < N; kt += tile_size) {
+            const Index_type kend = std::min(kt + tile_size, N);
+
+            // diagonal block
+            #pragma omp single
+            {
+              POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(kt, kend, kt, kend, kt, kend);
+            }
+
+            // blocks in the block row and block column of the diagonal block
+            #pragma omp for
+            for (Index_type t = 0; t < N; t += tile_size) {
+              if (t != kt) {
+                const Index_type tend = std::min(t + tile_size, N);
+                POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(kt, kend, t, tend, kt, kend);
+                POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(t, tend, kt, kend, kt, kend);
+              }
+            }
+
+            // remaining blocks
+            #pragma omp for collapse(2)
+            for (Index_type it = 0; it < N; it += tile_size) {
+              for (Index_type jt = 0; jt < N; jt += tile_size) {
+                if (it != kt && jt != kt) {
+                  const Index_type iend = std::min(it + tile_size, N);
+                  const Index_type jend = std::min(jt + tile_size, N);
+                  POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(it, iend, jt, jend, kt, kend);
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile_size);
+#endif
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (Index_type tile_size : m_tile_sizes) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBlocked(vid, tile_size);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBlockedTuningNames(vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
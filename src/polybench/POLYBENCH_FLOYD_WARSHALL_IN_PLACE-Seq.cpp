@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_IN_PLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_IN_PLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < N; ++k) {
+          for (Index_type i = 0; i < N; ++i) {
+            for (Index_type j = 0; j < N; ++j) {
+              POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runSeqVariantBlocked(VariantID vid,
+                                                             Index_type tile_size)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_FLOYD_WARSHALL_IN_PLACE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kt = 0; kt < N; kt += tile_size) {
+          const Index_type kend = std::min(kt + tile_size, N);
+
+          // diagonal block
+          POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(kt, kend, kt, kend, kt, kend);
+
+          // blocks in the block row and block column of the diagonal block
+          for (Index_type t = 0; t < N; t += tile_size) {
+            if (t != kt) {
+              const Index_type tend = std::min(t + tile_size, N);
+              POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(kt, kend, t, tend, kt, kend);
+              POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(t, tend, kt, kend, kt, kend);
+            }
+          }
+
+          // remaining blocks
+          for (Index_type it = 0; it < N; it += tile_size) {
+            for (Index_type jt = 0; jt < N; jt += tile_size) {
+              if (it != kt && jt != kt) {
+                const Index_type iend = std::min(it + tile_size, N);
+                const Index_type jend = std::min(jt + tile_size, N);
+                POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(it, iend, jt, jend, kt, kend);
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (Index_type tile_size : m_tile_sizes) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantBlocked(vid, tile_size);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBlockedTuningNames(vid);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,82 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_FLOYD_WARSHALL_IN_PLACE.hpp"
+#include "PolybenchData.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_FLOYD_WARSHALL_IN_PLACE::POLYBENCH_FLOYD_WARSHALL_IN_PLACE(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_FLOYD_WARSHALL_IN_PLACE, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(8);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+  m_tile_sizes = getGemmTileSizes(run_params);
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N*m_N );
+  setKernelsPerRep(1);
+  // p is read; it is only written while paths are still being shortened
+  setBytesPerRep( (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  setFLOPsPerRep(1 * m_N*m_N*m_N );
+
+  checksum_scale_factor = 1.0 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setVariantDefined( Base_Seq );
+
+  setVariantDefined( Base_OpenMP );
+}
+
+POLYBENCH_FLOYD_WARSHALL_IN_PLACE::~POLYBENCH_FLOYD_WARSHALL_IN_PLACE()
+{
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::addBlockedTuningNames(VariantID vid)
+{
+  for (Index_type tile_size : m_tile_sizes) {
+    addVariantTuningName(vid, getGemmTileName(tile_size));
+  }
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitDataRandValue(m_p, m_N*m_N, vid);
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_p, m_N*m_N, checksum_scale_factor );
+}
+
+void POLYBENCH_FLOYD_WARSHALL_IN_PLACE::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_p);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
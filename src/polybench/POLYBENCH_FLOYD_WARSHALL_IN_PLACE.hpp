@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_FLOYD_WARSHALL_IN_PLACE kernel reference implementation:
+///
+/// Note: this is the original in place recurrence that the
+///       POLYBENCH_FLOYD_WARSHALL kernel alters to enable parallelism.
+///
+/// for (Index_type k = 0; k < N; k++) {
+///   for (Index_type i = 0; i < N; i++) {
+///     for (Index_type j = 0; j < N; j++) {
+///       if (p[i][k] + p[k][j] < p[i][j]) {
+///         p[i][j] = p[i][k] + p[k][j];
+///       }
+///     }
+///   }
+/// }
+///
+/// The edge weights are random and non-negative, so row k and column k
+/// do not change in step k and the rows of one step may be updated in
+/// parallel. Shortest path lengths are a fixed point of the recurrence, so
+/// reps after the first compute the same result without writing p.
+///
+/// The blocked ("tile_<n>", see --gemm_tile_size) tunings process n x n
+/// blocks of p for each block of k in three phases: the diagonal block,
+/// the blocks in its block row and block column, and then all remaining
+/// blocks, which reuse the finished row and column blocks from cache.
+///
+
+#ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_IN_PLACE_HPP
+#define RAJAPerf_POLYBENCH_FLOYD_WARSHALL_IN_PLACE_HPP
+
+#define POLYBENCH_FLOYD_WARSHALL_IN_PLACE_DATA_SETUP \
+  Real_ptr p = m_p; \
+  const Index_type N = m_N;
+
+
+#define POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BODY \
+  if ( p[k + i*N] + p[j + k*N] < p[j + i*N] ) { \
+    p[j + i*N] = p[k + i*N] + p[j + k*N]; \
+  }
+
+#define POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BLOCK(i0, i1, j0, j1, k0, k1) \
+  for (Index_type k = k0; k < k1; ++k) { \
+    for (Index_type i = i0; i < i1; ++i) { \
+      for (Index_type j = j0; j < j1; ++j) { \
+        POLYBENCH_FLOYD_WARSHALL_IN_PLACE_BODY; \
+      } \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_FLOYD_WARSHALL_IN_PLACE : public KernelBase
+{
+public:
+
+  POLYBENCH_FLOYD_WARSHALL_IN_PLACE(const RunParams& params);
+
+  ~POLYBENCH_FLOYD_WARSHALL_IN_PLACE();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  POLYBENCH_FLOYD_WARSHALL_IN_PLACE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBlocked(VariantID vid, Index_type tile_size);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBlocked(VariantID vid, Index_type tile_size);
+
+private:
+  void addBlockedTuningNames(VariantID vid);
+
+  std::vector<Index_type> m_tile_sizes;
+
+  Index_type m_N;
+
+  Real_ptr m_p;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
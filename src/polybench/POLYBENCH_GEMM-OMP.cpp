@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +20,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMM::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -153,5 +154,284 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+void POLYBENCH_GEMM::runOpenMPVariantTiled(VariantID vid, Index_type tile_size)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+  RAJA_UNUSED_VAR(beta);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                POLYBENCH_GEMM_TILE_BODY1;
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    POLYBENCH_GEMM_TILE_BODY2;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_gemm_tile_base_lam1 = [=](Index_type i, Index_type j) {
+                                        POLYBENCH_GEMM_TILE_BODY1;
+                                      };
+      auto poly_gemm_tile_base_lam2 = [=](Index_type i, Index_type j,
+                                          Index_type k) {
+                                        POLYBENCH_GEMM_TILE_BODY2;
+                                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for collapse(2)
+        for (Index_type it = 0; it < ni; it += tile_size ) {
+          for (Index_type jt = 0; jt < nj; jt += tile_size ) {
+            const Index_type iend = std::min(it + tile_size, ni);
+            const Index_type jend = std::min(jt + tile_size, nj);
+            for (Index_type i = it; i < iend; ++i ) {
+              for (Index_type j = jt; j < jend; ++j ) {
+                poly_gemm_tile_base_lam1(i, j);
+              }
+            }
+            for (Index_type kt = 0; kt < nk; kt += tile_size ) {
+              const Index_type kend = std::min(kt + tile_size, nk);
+              for (Index_type i = it; i < iend; ++i ) {
+                for (Index_type k = kt; k < kend; ++k ) {
+                  for (Index_type j = jt; j < jend; ++j ) {
+                    poly_gemm_tile_base_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_GEMM_VIEWS_RAJA;
+
+      auto poly_gemm_tile_lam1 = [=](Index_type i, Index_type j) {
+                                     POLYBENCH_GEMM_TILE_BODY1_RAJA;
+                                   };
+      auto poly_gemm_tile_lam2 = [=](Index_type i, Index_type j,
+                                     Index_type k) {
+                                     POLYBENCH_GEMM_TILE_BODY2_RAJA;
+                                   };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<1, RAJA::tile_dynamic<1>, RAJA::loop_exec,
+              RAJA::statement::For<0, RAJA::loop_exec,
+                RAJA::statement::For<1, RAJA::loop_exec,
+                  RAJA::statement::Lambda<0, RAJA::Segs<0,1>>
+                >
+              >,
+              RAJA::statement::Tile<2, RAJA::tile_dynamic<2>, RAJA::loop_exec,
+                RAJA::statement::For<0, RAJA::loop_exec,
+                  RAJA::statement::For<2, RAJA::loop_exec,
+                    RAJA::statement::For<1, RAJA::loop_exec,
+                      RAJA::statement::Lambda<1, RAJA::Segs<0,1,2>>
+                    >
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel_param<EXEC_POL>(
+
+          RAJA::make_tuple( RAJA::RangeSegment{0, ni},
+                            RAJA::RangeSegment{0, nj},
+                            RAJA::RangeSegment{0, nk} ),
+          RAJA::make_tuple( RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size},
+                            RAJA::TileSize{tile_size} ),
+
+          poly_gemm_tile_lam1,
+          poly_gemm_tile_lam2
+
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tile_size);
+#endif
+}
+
+void POLYBENCH_GEMM::runOpenMPVariantPacked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+  RAJA_UNUSED_VAR(beta);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmPackedOpenMP(ni, nj, nk, alpha, A, B, 0.0, C);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GEMM::runOpenMPVariantLibrary(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP) && \
+    defined(RAJA_PERFSUITE_ENABLE_BLAS)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GEMM_DATA_SETUP;
+  RAJA_UNUSED_VAR(beta);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        gemmLibrary(ni, nj, nk, alpha, A, B, 0.0, C);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  for (Index_type tile_size : m_tile_sizes) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantTiled(vid, tile_size);
+
+    }
+
+    t += 1;
+
+  }
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantPacked(vid);
+
+    }
+
+    t += 1;
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    if (tune_idx == t) {
+
+      runOpenMPVariantLibrary(vid);
+
+    }
+
+    t += 1;
+#endif
+
+  }
+}
+
+void POLYBENCH_GEMM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addGemmTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -35,6 +35,8 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
   m_alpha = 0.62;
   m_beta = 1.002;
 
+  m_tile_sizes = getGemmTileSizes(run_params);
+
 
   setActualProblemSize( m_ni * m_nj );
 
@@ -76,6 +78,22 @@ POLYBENCH_GEMM::~POLYBENCH_GEMM()
 {
 }
 
+void POLYBENCH_GEMM::addGemmTuningNames(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  for (Index_type tile_size : m_tile_sizes) {
+    addVariantTuningName(vid, getGemmTileName(tile_size));
+  }
+
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "packed");
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+    addVariantTuningName(vid, "library");
+#endif
+  }
+}
+
 void POLYBENCH_GEMM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   (void) vid;
@@ -19,6 +19,14 @@
 ///     C[i][j] = dot;
 ///   }
 /// }
+///
+/// The tiled tunings ("tile_<n>", see --gemm_tile_size) block the i, j, and
+/// k loops with n x n tiles and accumulate directly into C. The "packed"
+/// tuning copies panels of A and B into contiguous buffers and uses a
+/// register blocked micro-kernel (see PolybenchData.hpp). Both keep the
+/// k order of the sum, so checksums match the default tuning. The "library"
+/// tuning calls the system BLAS when RAJA_PERFSUITE_ENABLE_BLAS is on, as a
+/// baseline for the FLOP rate report.
 
 
 #ifndef RAJAPerf_POLYBENCH_GEMM_HPP
@@ -50,6 +58,13 @@
   C[j + i*nj] = dot;
 
 
+#define POLYBENCH_GEMM_TILE_BODY1 \
+  C[j + i*nj] = 0.0;
+
+#define POLYBENCH_GEMM_TILE_BODY2 \
+  C[j + i*nj] += alpha * A[k + i*nk] * B[j + k*nj];
+
+
 #define POLYBENCH_GEMM_BODY1_RAJA \
   dot = 0.0;
 
@@ -63,6 +78,13 @@
   Cview(i, j) = dot;
 
 
+#define POLYBENCH_GEMM_TILE_BODY1_RAJA \
+  Cview(i, j) = 0.0;
+
+#define POLYBENCH_GEMM_TILE_BODY2_RAJA \
+  Cview(i, j) += alpha * Aview(i, k) * Bview(k, j);
+
+
 #define POLYBENCH_GEMM_VIEWS_RAJA \
   using VIEW_TYPE = RAJA::View<Real_type, \
                                RAJA::Layout<2, Index_type, 1>>; \
@@ -73,6 +95,9 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -100,8 +125,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTiled(VariantID vid, Index_type tile_size);
+  void runSeqVariantPacked(VariantID vid);
+  void runSeqVariantLibrary(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid, Index_type tile_size);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runOpenMPVariantLibrary(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -112,6 +147,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addGemmTuningNames(VariantID vid);
+
+  std::vector<Index_type> m_tile_sizes;
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
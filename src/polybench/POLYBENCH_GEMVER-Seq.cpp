@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 #include <cstring>
 
 
@@ -20,7 +22,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GEMVER::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -223,5 +225,125 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
 }
 
+void POLYBENCH_GEMVER::runSeqVariantFused(VariantID vid, bool blocked)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_GEMVER_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      std::vector<Real_type> accs(n);
+      Real_ptr acc = accs.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < n; ++i ) {
+          acc[i] = 0.0;
+        }
+
+        if (blocked) {
+
+          for (Index_type i0 = 0; i0 < n; i0 += matvec_block_rows) {
+            const Index_type i1 = std::min(i0 + matvec_block_rows, n);
+            for (Index_type i = i0; i < i1; ++i ) {
+              for (Index_type j = 0; j < n; j++) {
+                POLYBENCH_GEMVER_BODY1;
+              }
+            }
+            for (Index_type j0 = 0; j0 < n; j0 += matvec_chunk_cols) {
+              const Index_type j1 = std::min(j0 + matvec_chunk_cols, n);
+              for (Index_type i = i0; i < i1; ++i ) {
+                for (Index_type j = j0; j < j1; ++j ) {
+                  POLYBENCH_GEMVER_BODY3_FUSED;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type i = 0; i < n; ++i ) {
+            for (Index_type j = 0; j < n; j++) {
+              POLYBENCH_GEMVER_BODY1;
+            }
+            for (Index_type j = 0; j < n; ++j ) {
+              POLYBENCH_GEMVER_BODY3_FUSED;
+            }
+          }
+
+        }
+
+        for (Index_type i = 0; i < n; ++i ) {
+          Real_type sum = acc[i];
+          POLYBENCH_GEMVER_BODY4_FUSED;
+          POLYBENCH_GEMVER_BODY5;
+        }
+
+        for (Index_type i = 0; i < n; i++ ) {
+          POLYBENCH_GEMVER_BODY6;
+          for (Index_type j = 0; j < n; j++) {
+            POLYBENCH_GEMVER_BODY7;
+          }
+          POLYBENCH_GEMVER_BODY8;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GEMVER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_GEMVER::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_GEMVER::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addFusedTuningNames(vid);
+}
+
 } // end namespace basic
 } // end namespace rajaperf
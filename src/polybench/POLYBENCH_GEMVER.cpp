@@ -49,6 +49,23 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
 
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n +
                   (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_n );
+  // fused tunings read A once for both products
+  setTuningBytesPerRep( "fused",
+                        (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n +
+                        (0*sizeof(Real_type ) + 4*sizeof(Real_type )) * m_n +
+
+                        (1*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_n +
+
+                        (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n +
+                        (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_n );
+  setTuningBytesPerRep( "blocked",
+                        (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n +
+                        (0*sizeof(Real_type ) + 4*sizeof(Real_type )) * m_n +
+
+                        (1*sizeof(Real_type ) + 3*sizeof(Real_type )) * m_n +
+
+                        (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * m_n +
+                        (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_n );
   setFLOPsPerRep(4 * m_n*m_n +
                  3 * m_n*m_n +
                  1 * m_n +
@@ -119,5 +136,13 @@ void POLYBENCH_GEMVER::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
   deallocData(m_z);
 }
 
+void POLYBENCH_GEMVER::addFusedTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "fused");
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -35,6 +35,15 @@
 ///   }
 /// }
 ///
+/// The "fused" and "blocked" tunings of the Base variants update A and
+/// compute x in one pass over A, leaving a second pass for w. Each row of A
+/// is updated and, while still in cache, adds its contribution to x (row j
+/// of A adds beta * A[j][i] * y[j] to x[i]); OpenMP threads accumulate these
+/// contributions in private arrays that are summed at the end. The
+/// "blocked" tuning handles blocks of rows and updates the accumulators in
+/// chunks that stay in cache across the rows of a block. Sequential
+/// checksums match the default tuning; OpenMP ones may differ by rounding.
+///
 
 
 
@@ -69,6 +78,12 @@
 #define POLYBENCH_GEMVER_BODY4 \
   x[i] += dot;
 
+#define POLYBENCH_GEMVER_BODY3_FUSED \
+  acc[j] +=  beta * A[j + i*n] * y[i];
+
+#define POLYBENCH_GEMVER_BODY4_FUSED \
+  x[i] += sum;
+
 #define POLYBENCH_GEMVER_BODY5 \
   x[i] += z[i];
 
@@ -126,6 +141,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
 
 namespace rajaperf
 {
@@ -153,8 +169,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid, bool blocked);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid, bool blocked);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -165,6 +187,8 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addFusedTuningNames(VariantID vid);
+
   Index_type m_n;
   Real_type m_alpha;
   Real_type m_beta;
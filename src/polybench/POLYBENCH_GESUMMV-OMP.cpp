@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +20,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GESUMMV::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -136,5 +137,91 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_A
 #endif
 }
 
+void POLYBENCH_GESUMMV::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i0 = 0; i0 < N; i0 += matvec_block_rows) {
+          const Index_type i1 = std::min(i0 + matvec_block_rows, N);
+          Real_type tmpdot[matvec_block_rows];
+          Real_type ydot[matvec_block_rows];
+
+          for (Index_type i = i0; i < i1; ++i ) {
+            POLYBENCH_GESUMMV_BODY1_BLOCKED;
+          }
+          for (Index_type j0 = 0; j0 < N; j0 += matvec_chunk_cols) {
+            const Index_type j1 = std::min(j0 + matvec_chunk_cols, N);
+            for (Index_type i = i0; i < i1; ++i ) {
+              for (Index_type j = j0; j < j1; ++j ) {
+                POLYBENCH_GESUMMV_BODY2_BLOCKED;
+              }
+            }
+          }
+          for (Index_type i = i0; i < i1; ++i ) {
+            POLYBENCH_GESUMMV_BODY3_BLOCKED;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runOpenMPVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    if (tune_idx == t) {
+
+      runOpenMPVariantBlocked(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_GESUMMV::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBlockedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -18,7 +19,7 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_GESUMMV::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -131,5 +132,85 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 
 }
 
+void POLYBENCH_GESUMMV::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_GESUMMV_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i0 = 0; i0 < N; i0 += matvec_block_rows) {
+          const Index_type i1 = std::min(i0 + matvec_block_rows, N);
+          Real_type tmpdot[matvec_block_rows];
+          Real_type ydot[matvec_block_rows];
+
+          for (Index_type i = i0; i < i1; ++i ) {
+            POLYBENCH_GESUMMV_BODY1_BLOCKED;
+          }
+          for (Index_type j0 = 0; j0 < N; j0 += matvec_chunk_cols) {
+            const Index_type j1 = std::min(j0 + matvec_chunk_cols, N);
+            for (Index_type i = i0; i < i1; ++i ) {
+              for (Index_type j = j0; j < j1; ++j ) {
+                POLYBENCH_GESUMMV_BODY2_BLOCKED;
+              }
+            }
+          }
+          for (Index_type i = i0; i < i1; ++i ) {
+            POLYBENCH_GESUMMV_BODY3_BLOCKED;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_GESUMMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantBlocked(vid);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_GESUMMV::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addBlockedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
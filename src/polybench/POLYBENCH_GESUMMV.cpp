@@ -88,5 +88,12 @@ void POLYBENCH_GESUMMV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   deallocData(m_B);
 }
 
+void POLYBENCH_GESUMMV::addBlockedTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -18,6 +18,12 @@
 ///   }
 ///   y[i] = alpha * tmp[i] + beta * y[i];
 /// }
+///
+/// A and B are already read in a single pass. The "blocked" tuning of the
+/// Base variants handles blocks of rows and walks x in chunks that stay in
+/// cache across the rows of a block, keeping partial dot products for each
+/// row. The sums run in the same order, so checksums match the default
+/// tuning.
 
 
 #ifndef RAJAPerf_POLYBENCH_GESUMMV_HPP
@@ -46,6 +52,17 @@
 #define POLYBENCH_GESUMMV_BODY3 \
   y[i] = alpha * tmpdot + beta * ydot;
 
+#define POLYBENCH_GESUMMV_BODY1_BLOCKED \
+  tmpdot[i - i0] = 0.0; \
+  ydot[i - i0] = 0.0;
+
+#define POLYBENCH_GESUMMV_BODY2_BLOCKED \
+  tmpdot[i - i0] += A[j + i*N] * x[j]; \
+  ydot[i - i0] += B[j + i*N] * x[j];
+
+#define POLYBENCH_GESUMMV_BODY3_BLOCKED \
+  y[i] = alpha * tmpdot[i - i0] + beta * ydot[i - i0];
+
 
 #define POLYBENCH_GESUMMV_BODY1_RAJA \
   tmpdot = 0.0; \
@@ -72,6 +89,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
 
 namespace rajaperf
 {
@@ -99,8 +117,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantBlocked(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantBlocked(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -110,6 +134,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addBlockedTuningNames(VariantID vid);
+
   Index_type m_N;
 
   Real_type m_alpha;
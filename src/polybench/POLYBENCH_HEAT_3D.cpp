@@ -30,6 +30,9 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
   m_N = std::cbrt( getTargetProblemSize() ) + 1;
   m_tsteps = 20;
 
+  // split tiling needs tiles at least four times as wide as the time block
+  m_time_tiles = {{8, 2}, {16, 4}};
+
 
   setActualProblemSize( (m_N-2) * (m_N-2) * (m_N-2) );
 
@@ -100,5 +103,14 @@ void POLYBENCH_HEAT_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   deallocData(m_Binit);
 }
 
+void POLYBENCH_HEAT_3D::addTimeTileTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    for (const TimeTile& tile : m_time_tiles) {
+      addVariantTuningName(vid, getTimeTileName(tile));
+    }
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -35,6 +35,16 @@
 ///   }
 ///
 /// }
+///
+/// The "time_tile_<s>x<t>" tunings of the Base variants apply split tiling
+/// over the time loop. The interior of the outermost dimension is cut into
+/// tiles of s planes, and each block of t time steps is run in two phases.
+/// First every tile is advanced through all 2t half steps (the B and A
+/// updates), shrinking by one plane per half step at tile edges shared with
+/// a neighbor. Then the inverted trapezoids left around each shared edge
+/// are filled in. Tiles within a phase are independent, each point is
+/// updated from the same values as in the reference loops, and the
+/// checksums match the default tuning exactly.
 
 
 #ifndef RAJAPerf_POLYBENCH_HEAT_3D_HPP
@@ -73,6 +83,25 @@
                            B[k-1 + N*(j + N*i)] ) + \
                    B[k + N*(j + N*i)];
 
+#define POLYBENCH_HEAT_3D_HALF_STEP(h, ibegin, iend) \
+  if ((h) % 2 == 0) { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      for (Index_type j = 1; j < N-1; ++j ) { \
+        for (Index_type k = 1; k < N-1; ++k ) { \
+          POLYBENCH_HEAT_3D_BODY1; \
+        } \
+      } \
+    } \
+  } else { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      for (Index_type j = 1; j < N-1; ++j ) { \
+        for (Index_type k = 1; k < N-1; ++k ) { \
+          POLYBENCH_HEAT_3D_BODY2; \
+        } \
+      } \
+    } \
+  }
+
 
 #define POLYBENCH_HEAT_3D_BODY1_RAJA \
   Bview(i,j,k) = \
@@ -98,6 +127,9 @@ using VIEW_TYPE = RAJA::View<Real_type, \
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -125,8 +157,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTimeTiled(VariantID vid, const TimeTile& tile);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTimeTiled(VariantID vid, const TimeTile& tile);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -137,6 +175,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addTimeTileTuningNames(VariantID vid);
+
+  std::vector<TimeTile> m_time_tiles;
+
   Index_type m_N;
   Index_type m_tsteps;
 
@@ -29,6 +29,9 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
   m_N = getTargetProblemSize();
   m_tsteps = 16;
 
+  // split tiling needs tiles at least four times as wide as the time block
+  m_time_tiles = {{2048, 4}, {4096, 8}, {16384, 16}};
+
 
   setActualProblemSize( m_N-2 );
 
@@ -97,5 +100,14 @@ void POLYBENCH_JACOBI_1D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   deallocData(m_Binit);
 }
 
+void POLYBENCH_JACOBI_1D::addTimeTileTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    for (const TimeTile& tile : m_time_tiles) {
+      addVariantTuningName(vid, getTimeTileName(tile));
+    }
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -18,6 +18,16 @@
 ///     A[i] = 0.33333 * (B[i-1] + B[i] + B[i + 1]);
 ///   }
 /// }
+///
+/// The "time_tile_<s>x<t>" tunings of the Base variants apply split tiling
+/// over the time loop. The interior of the outermost dimension is cut into
+/// tiles of s points, and each block of t time steps is run in two phases.
+/// First every tile is advanced through all 2t half steps (the B and A
+/// updates), shrinking by one point per half step at tile edges shared with
+/// a neighbor. Then the inverted trapezoids left around each shared edge
+/// are filled in. Tiles within a phase are independent, each point is
+/// updated from the same values as in the reference loops, and the
+/// checksums match the default tuning exactly.
 
 
 #ifndef RAJAPerf_POLYBENCH_JACOBI_1D_HPP
@@ -42,8 +52,22 @@
 #define POLYBENCH_JACOBI_1D_BODY2 \
   A[i] = 0.33333 * (B[i-1] + B[i] + B[i + 1]);
 
+#define POLYBENCH_JACOBI_1D_HALF_STEP(h, ibegin, iend) \
+  if ((h) % 2 == 0) { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      POLYBENCH_JACOBI_1D_BODY1; \
+    } \
+  } else { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      POLYBENCH_JACOBI_1D_BODY2; \
+    } \
+  }
+
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -71,8 +95,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTimeTiled(VariantID vid, const TimeTile& tile);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTimeTiled(VariantID vid, const TimeTile& tile);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -82,6 +112,10 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addTimeTileTuningNames(VariantID vid);
+
+  std::vector<TimeTile> m_time_tiles;
+
   Index_type m_N;
   Index_type m_tsteps;
 
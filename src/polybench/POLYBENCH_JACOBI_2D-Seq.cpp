@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 
@@ -19,7 +20,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_JACOBI_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -149,5 +150,97 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_AR
 
 }
 
+void POLYBENCH_JACOBI_2D::runSeqVariantTimeTiled(VariantID vid,
+                                                 const TimeTile& tile)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_JACOBI_2D_DATA_SETUP;
+
+  const Index_type ntiles = std::max(Index_type(1), (N-2) / tile.space);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type tt = 0; tt < tsteps; tt += tile.time) {
+          const Index_type nh = 2 * std::min(tile.time, tsteps - tt);
+
+          // upright trapezoids, shrinking at shared tile edges
+          for (Index_type it = 0; it < ntiles; ++it) {
+            const Index_type lo = 1 + it*tile.space;
+            const Index_type hi = (it == ntiles-1) ? N-1 : lo + tile.space;
+            for (Index_type h = 0; h < nh; ++h) {
+              const Index_type ibegin = (it == 0) ? lo : lo + h;
+              const Index_type iend = (it == ntiles-1) ? hi : hi - h;
+              POLYBENCH_JACOBI_2D_HALF_STEP(h, ibegin, iend);
+            }
+          }
+
+          // inverted trapezoids, growing around shared tile edges
+          for (Index_type it = 1; it < ntiles; ++it) {
+            const Index_type edge = 1 + it*tile.space;
+            for (Index_type h = 1; h < nh; ++h) {
+              POLYBENCH_JACOBI_2D_HALF_STEP(h, edge - h, edge + h);
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      POLYBENCH_JACOBI_2D_DATA_RESET;
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_JACOBI_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    for (const TimeTile& tile : m_time_tiles) {
+
+      if (tune_idx == t) {
+
+        runSeqVariantTimeTiled(vid, tile);
+
+      }
+
+      t += 1;
+
+    }
+
+  }
+}
+
+void POLYBENCH_JACOBI_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addTimeTileTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -29,6 +29,9 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
   m_N = std::sqrt( getTargetProblemSize() ) + 1;
   m_tsteps = 40;
 
+  // split tiling needs tiles at least four times as wide as the time block
+  m_time_tiles = {{16, 4}, {32, 8}};
+
 
   setActualProblemSize( (m_N-2) * (m_N-2) );
 
@@ -99,5 +102,14 @@ void POLYBENCH_JACOBI_2D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   deallocData(m_Binit);
 }
 
+void POLYBENCH_JACOBI_2D::addTimeTileTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    for (const TimeTile& tile : m_time_tiles) {
+      addVariantTuningName(vid, getTimeTileName(tile));
+    }
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
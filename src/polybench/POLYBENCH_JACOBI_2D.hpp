@@ -22,6 +22,16 @@
 ///     }
 ///   }
 /// }
+///
+/// The "time_tile_<s>x<t>" tunings of the Base variants apply split tiling
+/// over the time loop. The interior of the outermost dimension is cut into
+/// tiles of s rows, and each block of t time steps is run in two phases.
+/// First every tile is advanced through all 2t half steps (the B and A
+/// updates), shrinking by one row per half step at tile edges shared with
+/// a neighbor. Then the inverted trapezoids left around each shared edge
+/// are filled in. Tiles within a phase are independent, each point is
+/// updated from the same values as in the reference loops, and the
+/// checksums match the default tuning exactly.
 
 
 #ifndef RAJAPerf_POLYBENCH_JACOBI_2D_HPP
@@ -47,6 +57,21 @@
 #define POLYBENCH_JACOBI_2D_BODY2 \
   A[j + i*N] = 0.2 * (B[j + i*N] + B[j-1 + i*N] + B[j+1 + i*N] + B[j + (i+1)*N] + B[j + (i-1)*N]);
 
+#define POLYBENCH_JACOBI_2D_HALF_STEP(h, ibegin, iend) \
+  if ((h) % 2 == 0) { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      for (Index_type j = 1; j < N-1; ++j ) { \
+        POLYBENCH_JACOBI_2D_BODY1; \
+      } \
+    } \
+  } else { \
+    for (Index_type i = ibegin; i < iend; ++i ) { \
+      for (Index_type j = 1; j < N-1; ++j ) { \
+        POLYBENCH_JACOBI_2D_BODY2; \
+      } \
+    } \
+  }
+
 
 #define POLYBENCH_JACOBI_2D_BODY1_RAJA \
   Bview(i,j) = 0.2 * (Aview(i,j) + Aview(i,j-1) + Aview(i,j+1) + Aview(i+1,j) + Aview(i-1,j));
@@ -64,6 +89,9 @@ using VIEW_TYPE = RAJA::View<Real_type, \
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
+
+#include <vector>
 
 namespace rajaperf
 {
@@ -91,8 +119,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantTimeTiled(VariantID vid, const TimeTile& tile);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantTimeTiled(VariantID vid, const TimeTile& tile);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -103,6 +137,10 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  void addTimeTileTuningNames(VariantID vid);
+
+  std::vector<TimeTile> m_time_tiles;
+
   Index_type m_N;
   Index_type m_tsteps;
 
@@ -10,7 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 
 namespace rajaperf
@@ -19,7 +21,7 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void POLYBENCH_MVT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
@@ -178,5 +180,120 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
 }
 
+void POLYBENCH_MVT::runSeqVariantFused(VariantID vid, bool blocked)
+{
+  const Index_type run_reps = getRunReps();
+
+  POLYBENCH_MVT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      std::vector<Real_type> accs(N);
+      Real_ptr acc = accs.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          acc[i] = 0.0;
+        }
+
+        if (blocked) {
+
+          for (Index_type i0 = 0; i0 < N; i0 += matvec_block_rows) {
+            const Index_type i1 = std::min(i0 + matvec_block_rows, N);
+            for (Index_type i = i0; i < i1; ++i ) {
+              POLYBENCH_MVT_BODY1;
+              for (Index_type j = 0; j < N; ++j ) {
+                POLYBENCH_MVT_BODY2;
+              }
+              POLYBENCH_MVT_BODY3;
+            }
+            for (Index_type j0 = 0; j0 < N; j0 += matvec_chunk_cols) {
+              const Index_type j1 = std::min(j0 + matvec_chunk_cols, N);
+              for (Index_type i = i0; i < i1; ++i ) {
+                for (Index_type j = j0; j < j1; ++j ) {
+                  POLYBENCH_MVT_BODY5_FUSED;
+                }
+              }
+            }
+          }
+
+        } else {
+
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_MVT_BODY1;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY2;
+            }
+            POLYBENCH_MVT_BODY3;
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_MVT_BODY5_FUSED;
+            }
+          }
+
+        }
+
+        for (Index_type i = 0; i < N; ++i ) {
+          Real_type sum = acc[i];
+          POLYBENCH_MVT_BODY6_FUSED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_MVT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_MVT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+
+    runSeqVariantDefault(vid);
+
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, false);
+
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+
+      runSeqVariantFused(vid, true);
+
+    }
+
+    t += 1;
+
+  }
+}
+
+void POLYBENCH_MVT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addFusedTuningNames(vid);
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -37,6 +37,13 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N +
                   (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N +
                   (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  // fused tunings read A once for both products
+  setTuningBytesPerRep( "fused",
+                        (2*sizeof(Real_type ) + 4*sizeof(Real_type )) * m_N +
+                        (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  setTuningBytesPerRep( "blocked",
+                        (2*sizeof(Real_type ) + 4*sizeof(Real_type )) * m_N +
+                        (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
   setFLOPsPerRep(2 * m_N*m_N +
                  2 * m_N*m_N );
 
@@ -94,5 +101,13 @@ void POLYBENCH_MVT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
   deallocData(m_A);
 }
 
+void POLYBENCH_MVT::addFusedTuningNames(VariantID vid)
+{
+  if (vid == Base_Seq || vid == Base_OpenMP) {
+    addVariantTuningName(vid, "fused");
+    addVariantTuningName(vid, "blocked");
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -19,6 +19,15 @@
 ///     x2[i] += A[j][i] * y2[i];
 ///   }
 /// }
+///
+/// The "fused" and "blocked" tunings of the Base variants compute both
+/// products in one pass over A. Each row of A is used for x1[i] and, while
+/// still in cache, for its contribution to x2 (row i of A adds
+/// A[i][j] * y2[j] to x2[j]); OpenMP threads accumulate these contributions
+/// in private arrays that are summed at the end. The "blocked" tuning
+/// handles blocks of rows and updates the accumulators in chunks that stay
+/// in cache across the rows of a block. Sequential checksums match the
+/// default tuning; OpenMP ones may differ by rounding.
 
 
 #ifndef RAJAPerf_POLYBENCH_MVT_HPP
@@ -51,6 +60,12 @@
 #define POLYBENCH_MVT_BODY6 \
   x2[i] += dot;
 
+#define POLYBENCH_MVT_BODY5_FUSED \
+  acc[j] += A[j + i*N] * y2[j];
+
+#define POLYBENCH_MVT_BODY6_FUSED \
+  x2[i] += sum;
+
 
 #define POLYBENCH_MVT_BODY1_RAJA \
   dot = 0.0;
@@ -86,6 +101,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "PolybenchData.hpp"
 
 namespace rajaperf
 {
@@ -113,8 +129,14 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid, bool blocked);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantFused(VariantID vid, bool blocked);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
@@ -124,6 +146,8 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  void addFusedTuningNames(VariantID vid);
+
   Index_type m_N;
   Real_ptr m_x1;
   Real_ptr m_x2;
@@ -0,0 +1,263 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "common/RAJAPerfSuite.hpp"
+#include "common/RunParams.hpp"
+#include "PolybenchData.hpp"
+
+#include <algorithm>
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+#include <cblas.h>
+#endif
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+namespace
+{
+
+//
+// Blocking of packed matrix multiply: an mc x kc panel of X and a kc x nc
+// panel of Y are packed per block, and the micro-kernel updates an mr x nr
+// block of Out held in registers.
+//
+const Index_type gemm_mc = 64;
+const Index_type gemm_kc = 256;
+const Index_type gemm_nc = 2048;
+const Index_type gemm_mr = 4;
+const Index_type gemm_nr = 8;
+
+//
+// Pack rows [i0, i0 + mr) and columns [k0, k0 + kc) of X, scaled, into a
+// k-major micro-panel; rows past mr are zero padded.
+//
+void packXPanel(Real_ptr x_pack, const Real_type* X, Index_type nk,
+                Real_type scale, Index_type i0, Index_type mr,
+                Index_type k0, Index_type kc)
+{
+  for (Index_type k = 0; k < kc; ++k) {
+    for (Index_type r = 0; r < gemm_mr; ++r) {
+      x_pack[r + k*gemm_mr] = (r < mr) ? scale * X[k0 + k + (i0 + r)*nk]
+                                       : 0.0;
+    }
+  }
+}
+
+//
+// Pack rows [k0, k0 + kc) and columns [j0, j0 + nr) of Y into a k-major
+// micro-panel; columns past nr are zero padded.
+//
+void packYPanel(Real_ptr y_pack, const Real_type* Y, Index_type n,
+                Index_type k0, Index_type kc, Index_type j0, Index_type nr)
+{
+  for (Index_type k = 0; k < kc; ++k) {
+    for (Index_type c = 0; c < gemm_nr; ++c) {
+      y_pack[c + k*gemm_nr] = (c < nr) ? Y[j0 + c + (k0 + k)*n] : 0.0;
+    }
+  }
+}
+
+//
+// Update an mr x nr block of Out with one kc long slice of the k sum,
+// starting the sum at init for the first slice.
+//
+void gemmMicroKernel(Index_type kc,
+                     const Real_type* x_pack, const Real_type* y_pack,
+                     Real_ptr out, Index_type ldo,
+                     Index_type mr, Index_type nr,
+                     bool first, Real_type init)
+{
+  Real_type acc[gemm_mr][gemm_nr];
+
+  for (Index_type r = 0; r < gemm_mr; ++r) {
+    for (Index_type c = 0; c < gemm_nr; ++c) {
+      acc[r][c] = (r < mr && c < nr) ? (first ? init : out[c + r*ldo]) : 0.0;
+    }
+  }
+
+  for (Index_type k = 0; k < kc; ++k) {
+    for (Index_type r = 0; r < gemm_mr; ++r) {
+      const Real_type xv = x_pack[r + k*gemm_mr];
+      for (Index_type c = 0; c < gemm_nr; ++c) {
+        acc[r][c] += xv * y_pack[c + k*gemm_nr];
+      }
+    }
+  }
+
+  for (Index_type r = 0; r < mr; ++r) {
+    for (Index_type c = 0; c < nr; ++c) {
+      out[c + r*ldo] = acc[r][c];
+    }
+  }
+}
+
+//
+// Pack the X panel for rows [ic, ic + mc) and apply the micro-kernel to the
+// corresponding rows of Out, given the packed Y panel for columns
+// [jc, jc + nc).
+//
+void gemmBlock(Index_type n, Index_type nk,
+               Real_type scale, const Real_type* X,
+               Real_ptr x_pack, const Real_type* y_pack,
+               Index_type ic, Index_type mc,
+               Index_type jc, Index_type nc,
+               Index_type pc, Index_type kc,
+               Real_type init, Real_ptr Out)
+{
+  for (Index_type ir = 0; ir < mc; ir += gemm_mr) {
+    packXPanel(x_pack + ir*kc, X, nk, scale,
+               ic + ir, std::min(gemm_mr, mc - ir), pc, kc);
+  }
+
+  for (Index_type jr = 0; jr < nc; jr += gemm_nr) {
+    for (Index_type ir = 0; ir < mc; ir += gemm_mr) {
+      gemmMicroKernel(kc, x_pack + ir*kc, y_pack + jr*kc,
+                      Out + jc + jr + (ic + ir)*n, n,
+                      std::min(gemm_mr, mc - ir), std::min(gemm_nr, nc - jr),
+                      pc == 0, init);
+    }
+  }
+}
+
+} // end anonymous namespace
+
+//
+// Get tile sizes to run.
+//
+std::vector<Index_type> getGemmTileSizes(const RunParams& params)
+{
+  std::vector<Index_type> tile_sizes;
+  for (size_t tile_size : params.getGemmTileSizes()) {
+    tile_sizes.emplace_back(static_cast<Index_type>(tile_size));
+  }
+  if (tile_sizes.empty()) {
+    tile_sizes = {32, 64, 128};
+  }
+  return tile_sizes;
+}
+
+//
+// Get tuning name for tile size.
+//
+std::string getGemmTileName(Index_type tile_size)
+{
+  return "tile_" + std::to_string(tile_size);
+}
+
+//
+// Get tuning name for time tile.
+//
+std::string getTimeTileName(const TimeTile& tile)
+{
+  return "time_tile_" + std::to_string(tile.space) +
+         "x" + std::to_string(tile.time);
+}
+
+//
+// Packed matrix multiply.
+//
+void gemmPacked(Index_type m, Index_type n, Index_type nk,
+                Real_type scale, const Real_type* X, const Real_type* Y,
+                Real_type init, Real_ptr Out)
+{
+  if (nk <= 0) {
+    std::fill(Out, Out + m*n, init);
+    return;
+  }
+
+  std::vector<Real_type> x_pack(gemm_mc * gemm_kc);
+  std::vector<Real_type> y_pack(gemm_kc * gemm_nc);
+
+  for (Index_type jc = 0; jc < n; jc += gemm_nc) {
+    const Index_type nc = std::min(gemm_nc, n - jc);
+
+    for (Index_type pc = 0; pc < nk; pc += gemm_kc) {
+      const Index_type kc = std::min(gemm_kc, nk - pc);
+
+      for (Index_type jr = 0; jr < nc; jr += gemm_nr) {
+        packYPanel(y_pack.data() + jr*kc, Y, n,
+                   pc, kc, jc + jr, std::min(gemm_nr, nc - jr));
+      }
+
+      for (Index_type ic = 0; ic < m; ic += gemm_mc) {
+        gemmBlock(n, nk, scale, X, x_pack.data(), y_pack.data(),
+                  ic, std::min(gemm_mc, m - ic), jc, nc, pc, kc,
+                  init, Out);
+      }
+    }
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+//
+// Packed matrix multiply, OpenMP version.
+//
+void gemmPackedOpenMP(Index_type m, Index_type n, Index_type nk,
+                      Real_type scale, const Real_type* X, const Real_type* Y,
+                      Real_type init, Real_ptr Out)
+{
+  if (nk <= 0) {
+    std::fill(Out, Out + m*n, init);
+    return;
+  }
+
+  std::vector<Real_type> y_pack(gemm_kc * gemm_nc);
+
+  #pragma omp parallel
+  {
+    std::vector<Real_type> x_pack(gemm_mc * gemm_kc);
+
+    for (Index_type jc = 0; jc < n; jc += gemm_nc) {
+      const Index_type nc = std::min(gemm_nc, n - jc);
+
+      for (Index_type pc = 0; pc < nk; pc += gemm_kc) {
+        const Index_type kc = std::min(gemm_kc, nk - pc);
+
+        #pragma omp for
+        for (Index_type jr = 0; jr < nc; jr += gemm_nr) {
+          packYPanel(y_pack.data() + jr*kc, Y, n,
+                     pc, kc, jc + jr, std::min(gemm_nr, nc - jr));
+        }
+
+        #pragma omp for schedule(dynamic, 1)
+        for (Index_type ic = 0; ic < m; ic += gemm_mc) {
+          gemmBlock(n, nk, scale, X, x_pack.data(), y_pack.data(),
+                    ic, std::min(gemm_mc, m - ic), jc, nc, pc, kc,
+                    init, Out);
+        }
+      }
+    }
+  }
+}
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+//
+// Library matrix multiply.
+//
+void gemmLibrary(Index_type m, Index_type n, Index_type nk,
+                 Real_type scale, const Real_type* X, const Real_type* Y,
+                 Real_type init, Real_ptr Out)
+{
+  std::fill(Out, Out + m*n, init);
+
+#if defined(RP_USE_DOUBLE)
+  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+              m, n, nk, scale, X, nk, Y, n, 1.0, Out, n);
+#else
+  cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+              m, n, nk, scale, X, nk, Y, n, 1.0, Out, n);
+#endif
+}
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-23, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJAPerf_PolybenchData_HPP
+#define RAJAPerf_PolybenchData_HPP
+
+#include "common/RPTypes.hpp"
+#include "rajaperf_config.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace polybench
+{
+
+//
+// Tile sizes swept by tiled matrix multiply and blocked Floyd-Warshall
+// tunings, using the --gemm_tile_size sizes when given and 32, 64, and 128
+// otherwise.
+//
+std::vector<Index_type> getGemmTileSizes(const RunParams& params);
+
+//
+// Tuning name for a tile size, e.g. "tile_64".
+//
+std::string getGemmTileName(Index_type tile_size);
+
+//
+// Rows per block and columns per chunk of the blocked matrix-vector
+// tunings. A block of rows of the matrix stays in cache while each chunk
+// of the transposed product is updated by all rows of the block.
+//
+const Index_type matvec_block_rows = 8;
+const Index_type matvec_chunk_cols = 1024;
+
+//
+// Space and time tile sizes of a temporally blocked stencil tuning: the
+// number of points along the outermost dimension per tile and the number
+// of time steps per time block.
+//
+struct TimeTile
+{
+  Index_type space;
+  Index_type time;
+};
+
+//
+// Tuning name for a time tile, e.g. "time_tile_32x8".
+//
+std::string getTimeTileName(const TimeTile& tile);
+
+//
+// Row-major matrix multiply used by packed tunings,
+//
+//   Out[i][j] = init + sum_k (scale * X[i][k]) * Y[k][j]
+//
+// with X (m x nk), Y (nk x n), and Out (m x n). Panels of X and Y are packed
+// into contiguous buffers and a register blocked micro-kernel updates small
+// blocks of Out. The k sum runs in order, so results match the reference
+// loops of the kernels exactly.
+//
+void gemmPacked(Index_type m, Index_type n, Index_type nk,
+                Real_type scale, const Real_type* X, const Real_type* Y,
+                Real_type init, Real_ptr Out);
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+//
+// OpenMP version of gemmPacked; threads share each packed Y panel and
+// divide the rows of Out between them.
+//
+void gemmPackedOpenMP(Index_type m, Index_type n, Index_type nk,
+                      Real_type scale, const Real_type* X, const Real_type* Y,
+                      Real_type init, Real_ptr Out);
+#endif
+
+#if defined(RAJA_PERFSUITE_ENABLE_BLAS)
+//
+// Same operation as gemmPacked computed by the system BLAS (cblas_dgemm),
+// used as a baseline for the hand written tunings. The k sum is reordered
+// by the library, so checksums may differ slightly.
+//
+void gemmLibrary(Index_type m, Index_type n, Index_type nk,
+                 Real_type scale, const Real_type* X, const Real_type* Y,
+                 Real_type init, Real_ptr Out);
+#endif
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard